@@ -0,0 +1,436 @@
+/*
+
+FILE: MSSCache.hpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+
+// Macro Guard
+#ifndef MSS_CACHE_H
+#define MSS_CACHE_H
+
+// Files included
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <stdint.h>
+
+// POSIX
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <utime.h>
+
+
+namespace mss {
+
+namespace detail {
+
+  typedef uint64_t HashType;
+
+  inline HashType Word(unsigned long hi, unsigned long lo)
+    { return((HashType(hi) << 32) | HashType(lo)); }
+
+  inline HashType Rotl(HashType x, int r)
+    { return((x << r) | (x >> (64 - r))); }
+
+  inline HashType Prime(int i) {
+    switch (i) {
+      case 1: return(Word(0x9E3779B1UL, 0x85EBCA87UL));
+      case 2: return(Word(0xC2B2AE3DUL, 0x27D4EB4FUL));
+      case 3: return(Word(0x165667B1UL, 0x9E3779F9UL));
+      case 4: return(Word(0x85EBCA77UL, 0xC2B2AE63UL));
+      default: return(Word(0x27D4EB2FUL, 0x165667C5UL));
+    }
+  }
+
+  inline HashType Read8(const unsigned char* p)
+    { HashType w; std::memcpy(&w, p, sizeof(w)); return(w); }
+
+  inline HashType Round(HashType acc, HashType w)
+    { return(Rotl(acc + w * Prime(2), 31) * Prime(1)); }
+
+  inline HashType Merge(HashType h, HashType v)
+    { return((h ^ Round(0, v)) * Prime(1) + Prime(4)); }
+
+  /*
+    64-bit hash of n bytes, after xxHash64: four independent lanes over
+     32-byte stripes, so it runs near memory bandwidth.  Words are read in
+     native byte order.
+  */
+  inline HashType HashBytes(const unsigned char* p, std::size_t n,
+                            HashType seed) {
+    const unsigned char* end = p + n;
+    HashType h;
+    if ( n >= 32 ) {
+      HashType v1 = seed + Prime(1) + Prime(2), v2 = seed + Prime(2);
+      HashType v3 = seed, v4 = seed - Prime(1);
+      for ( ; end - p >= 32; p += 32 ) {
+        v1 = Round(v1, Read8(p));
+        v2 = Round(v2, Read8(p + 8));
+        v3 = Round(v3, Read8(p + 16));
+        v4 = Round(v4, Read8(p + 24));
+      } // for
+      h = Rotl(v1, 1) + Rotl(v2, 7) + Rotl(v3, 12) + Rotl(v4, 18);
+      h = Merge(Merge(Merge(Merge(h, v1), v2), v3), v4);
+    }
+    else
+      h = seed + Prime(5);
+
+    h += HashType(n);
+    for ( ; end - p >= 8; p += 8 )
+      h = Rotl(h ^ Round(0, Read8(p)), 27) * Prime(1) + Prime(4);
+    for ( ; p != end; ++p )
+      h = Rotl(h ^ (HashType(*p) * Prime(5)), 11) * Prime(1);
+
+    h ^= h >> 33;
+    h *= Prime(2);
+    h ^= h >> 29;
+    h *= Prime(3);
+    h ^= h >> 32;
+    return(h);
+  }
+
+  inline std::string Hex(HashType h) {
+    char buf[17];
+    for ( int i = 15; i >= 0; --i, h >>= 4 )
+      buf[i] = "0123456789abcdef"[h & 0xF];
+    buf[16] = '\0';
+    return(buf);
+  }
+
+} // namespace detail
+
+
+/*
+ =============
+ ResultCache :
+ =============
+  o Results of AlgMSS() runs, kept in a directory on local disk and looked
+     up by content: the key of a result is a digest of the input's bytes
+     together with the threshold and a caller-chosen options string (any
+     filter applied to the results, say).  Unchanged input and parameters
+     give the same key, however the input is named or wherever it lives.
+  o Digest() hashes the input in blocks of BlockSize() bytes and then hashes
+     the block digests.  FileDigest() also remembers the digest of a file
+     for as long as its size, inode and modification time stay the same
+     (and that time is older than the hashing), so rerunning on an
+     unchanged file costs a stat() and no hashing at all.
+  o Block digests are not kept: once a file changes at all, every block is
+     hashed again.  Telling which blocks changed would mean reading them,
+     and the hash already runs at about the speed of that read, so stored
+     block digests would save disk reads only if the caller knew which
+     ranges it had modified.  Blocks fix the digest's layout, so that such
+     reuse could be added without changing any key.
+  o Find() returns stored results; Store() adds them and then evicts the
+     least recently used entries (a hit counts as a use) until everything
+     kept fits in MaxBytes().  Entries are written to a temporary name and
+     renamed, so processes may share one directory.  Remembered file
+     digests are a few dozen bytes each and are not counted or evicted.
+  o Digests use native byte order and sizes, like the files they describe;
+     a cache directory should not be shared across unlike machines.
+  o Find() and Store() report failure by returning false: a cache that
+     cannot be read or written is only a slower cache.  The constructor
+     throws std::runtime_error if the directory cannot be created.
+*/
+class ResultCache {
+
+public:
+
+  // typedefs
+  typedef std::size_t SizeType;
+  typedef detail::HashType DigestType;
+
+  // One stored result: positions [first_, last_) and its score
+  struct Segment {
+    uint64_t first_, last_;
+    double score_;
+  };
+
+  ResultCache(const std::string& directory, SizeType maxBytes,
+              SizeType blockSize = SizeType(1) << 20)
+    : dir_(directory), maxBytes_(maxBytes),
+      blockSize_(blockSize ? blockSize : 1) {
+    ::mkdir(dir_.c_str(), 0777);
+    struct stat st;
+    if ( ::stat(dir_.c_str(), &st) != 0 || !S_ISDIR(st.st_mode) )
+      throw std::runtime_error("mss::ResultCache: unable to use: " + dir_);
+  }
+
+  const std::string& Directory() const { return(dir_); }
+  SizeType MaxBytes() const { return(maxBytes_); }
+  SizeType BlockSize() const { return(blockSize_); }
+
+  // Digest of n bytes at data
+  DigestType Digest(const void* data, SizeType n) const {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    std::vector<DigestType> blocks;
+    blocks.reserve(n / blockSize_ + 1);
+    for ( SizeType i = 0; i < n; i += blockSize_ )
+      blocks.push_back(detail::HashBytes(p + i, std::min(blockSize_, n - i),
+                                         DigestType(i / blockSize_)));
+    const unsigned char* top = blocks.empty() ? 0 :
+      reinterpret_cast<const unsigned char*>(&blocks[0]);
+    return(detail::HashBytes(top, blocks.size() * sizeof(DigestType),
+                             DigestType(n)));
+  }
+
+  /*
+    Digest of the file at path, whose contents are the n bytes at data (ie;
+     its memory mapping).  Reuses the remembered digest if the file is
+     unchanged since it was last computed.  As with git's racily clean
+     index entries, a file modified within the same timestamp tick as the
+     hashing began (so its modification time could hide a later rewrite)
+     is never trusted and is hashed again.
+  */
+  DigestType FileDigest(const std::string& path, const void* data,
+                        SizeType n) const {
+    struct stat st;
+    if ( ::stat(path.c_str(), &st) != 0 || SizeType(st.st_size) != n )
+      return(Digest(data, n));
+
+    FileStamp now = stamp(st);
+    std::string memo = dir_ + "/" + detail::Hex(detail::HashBytes(
+                         reinterpret_cast<const unsigned char*>(path.data()),
+                         path.size(), 0)) + ".digest";
+    FileStamp old;
+    std::FILE* in = std::fopen(memo.c_str(), "rb");
+    if ( in ) {
+      bool ok = (std::fread(&old, sizeof(old), 1, in) == 1);
+      std::fclose(in);
+      DigestType digest = old.digest_;
+      bool settled = ok && before(old.seconds_, old.nanoseconds_,
+                                  old.hashedSeconds_, old.hashedNanoseconds_);
+      old.digest_ = old.hashedSeconds_ = old.hashedNanoseconds_ = 0;
+      if ( settled && std::memcmp(&old, &now, sizeof(now)) == 0 )
+        return(digest);
+    }
+
+    // The new memo's own timestamp, taken before hashing, says when the
+    //  digest was computed, on the file system's clock
+    std::string tmp = tempName(memo);
+    std::FILE* out = std::fopen(tmp.c_str(), "wb");
+    struct stat hashed;
+    if ( out && ::stat(tmp.c_str(), &hashed) == 0 ) {
+      now.hashedSeconds_ = hashed.st_mtim.tv_sec;
+      now.hashedNanoseconds_ = hashed.st_mtim.tv_nsec;
+    }
+    now.digest_ = Digest(data, n);
+    if ( out ) {
+      bool ok = (std::fwrite(&now, sizeof(now), 1, out) == 1);
+      ok = (std::fclose(out) == 0) && ok;
+      if ( !ok || std::rename(tmp.c_str(), memo.c_str()) != 0 )
+        std::remove(tmp.c_str());
+    }
+    return(now.digest_);
+  }
+
+  // Cache key for an input digest, threshold and options
+  std::string Key(DigestType digest, double threshold,
+                  const std::string& options = "") const {
+    return(detail::Hex(digest) + "-" +
+           detail::Hex(paramHash(threshold, options)));
+  }
+
+  /*
+    Looks up key, as made by Key(digest, threshold, options).  On a hit,
+     replaces the contents of results and returns true.
+  */
+  bool Find(const std::string& key, double threshold,
+            const std::string& options, std::vector<Segment>& results) const {
+    std::string path = entry(key);
+    std::FILE* in = std::fopen(path.c_str(), "rb");
+    if ( !in )
+      return(false);
+
+    Header h;
+    std::string opts;
+    bool ok = (std::fread(&h, sizeof(h), 1, in) == 1) &&
+              std::memcmp(h.magic_, magic(), sizeof(h.magic_)) == 0 &&
+              h.threshold_ == threshold && h.options_ == options.size();
+    if ( ok && h.options_ > 0 ) {
+      opts.resize(h.options_);
+      ok = (std::fread(&opts[0], 1, opts.size(), in) == opts.size()) &&
+           opts == options;
+    }
+    std::vector<Segment> found;
+    if ( ok && h.count_ > 0 ) {
+      found.resize(h.count_);
+      ok = (std::fread(&found[0], sizeof(Segment), found.size(), in) ==
+            found.size());
+    }
+    std::fclose(in);
+    if ( !ok )
+      return(false);
+
+    ::utime(path.c_str(), 0); // most recently used
+    results.swap(found);
+    return(true);
+  }
+
+  // Stores results under key, then evicts down to MaxBytes()
+  bool Store(const std::string& key, double threshold,
+             const std::string& options,
+             const std::vector<Segment>& results) const {
+    Header h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic_, magic(), sizeof(h.magic_));
+    h.threshold_ = threshold;
+    h.options_ = options.size();
+    h.count_ = results.size();
+
+    std::string path = entry(key), tmp = tempName(path);
+    std::FILE* out = std::fopen(tmp.c_str(), "wb");
+    if ( !out )
+      return(false);
+    bool ok = (std::fwrite(&h, sizeof(h), 1, out) == 1) &&
+              std::fwrite(options.data(), 1, options.size(), out) ==
+                options.size();
+    if ( ok && !results.empty() )
+      ok = (std::fwrite(&results[0], sizeof(Segment), results.size(), out) ==
+            results.size());
+    ok = (std::fclose(out) == 0) && ok;
+    if ( !ok || std::rename(tmp.c_str(), path.c_str()) != 0 ) {
+      std::remove(tmp.c_str());
+      return(false);
+    }
+    Evict();
+    return(true);
+  }
+
+  // Total bytes of all stored results
+  SizeType Bytes() const {
+    std::vector<Entry> entries;
+    return(list(entries));
+  }
+
+  // Removes least recently used results until the rest fit in MaxBytes()
+  void Evict() const {
+    std::vector<Entry> entries;
+    SizeType total = list(entries);
+    std::sort(entries.begin(), entries.end());
+    for ( SizeType i = 0; i < entries.size() && total > maxBytes_; ++i ) {
+      if ( std::remove(entries[i].second.c_str()) == 0 )
+        total -= entries[i].first.second;
+    } // for
+  }
+
+
+private:
+
+  struct Header {
+    char magic_[8];
+    double threshold_;
+    uint64_t options_; // bytes of options that follow
+    uint64_t count_;   // Segments that follow the options
+  };
+
+  struct FileStamp {
+    uint64_t size_, inode_, device_;
+    int64_t seconds_, nanoseconds_;             // file's modification time
+    int64_t hashedSeconds_, hashedNanoseconds_; // when hashing began
+    DigestType digest_;
+  };
+
+  // ((mtime in nanoseconds, bytes), path)
+  typedef std::pair<std::pair<int64_t, SizeType>, std::string> Entry;
+
+  static const char* magic() { return("MSSRES1"); }
+
+  static FileStamp stamp(const struct stat& st) {
+    FileStamp s;
+    std::memset(&s, 0, sizeof(s));
+    s.size_ = st.st_size;
+    s.inode_ = st.st_ino;
+    s.device_ = st.st_dev;
+    s.seconds_ = st.st_mtim.tv_sec;
+    s.nanoseconds_ = st.st_mtim.tv_nsec;
+    return(s);
+  }
+
+  // Is time (s1, ns1) strictly before (s2, ns2)?
+  static bool before(int64_t s1, int64_t ns1, int64_t s2, int64_t ns2)
+    { return(s1 < s2 || (s1 == s2 && ns1 < ns2)); }
+
+  static std::string tempName(const std::string& path) {
+    char buf[32];
+    std::sprintf(buf, ".%ld.tmp", static_cast<long>(::getpid()));
+    return(path + buf);
+  }
+
+  static DigestType paramHash(double threshold, const std::string& options) {
+    std::string p(reinterpret_cast<const char*>(&threshold), sizeof(threshold));
+    p += options;
+    return(detail::HashBytes(reinterpret_cast<const unsigned char*>(p.data()),
+                             p.size(), 0));
+  }
+
+  std::string entry(const std::string& key) const
+    { return(dir_ + "/" + key + ".mss"); }
+
+  // Stored results, with their total size in bytes
+  SizeType list(std::vector<Entry>& entries) const {
+    SizeType total = 0;
+    DIR* d = ::opendir(dir_.c_str());
+    if ( !d )
+      return(total);
+    while ( dirent* e = ::readdir(d) ) {
+      std::string name = e->d_name;
+      if ( name.size() < 4 || name.compare(name.size() - 4, 4, ".mss") != 0 )
+        continue;
+      std::string path = dir_ + "/" + name;
+      struct stat st;
+      if ( ::stat(path.c_str(), &st) != 0 )
+        continue;
+      int64_t mtime = int64_t(st.st_mtim.tv_sec) * 1000000000 +
+                      st.st_mtim.tv_nsec;
+      entries.push_back(Entry(std::make_pair(mtime, SizeType(st.st_size)),
+                              path));
+      total += st.st_size;
+    } // while
+    ::closedir(d);
+    return(total);
+  }
+
+
+private:
+  std::string dir_;
+  SizeType maxBytes_;
+  SizeType blockSize_;
+};
+
+} // namespace mss
+
+#endif // MSS_CACHE_H
@@ -0,0 +1,377 @@
+/*
+
+FILE: MSSFasta.hpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+
+// Macro Guard
+#ifndef MSS_FASTA_H
+#define MSS_FASTA_H
+
+// Files included
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "MSSMappedFile.hpp"
+#include "MSSStack.hpp"
+
+// POSIX
+#include <pthread.h>
+
+
+namespace mss {
+
+//===========================================================================
+// ScoreTable: a score for each of the 256 byte values.  Residues not given
+//  a score with Set() get the default.
+//===========================================================================
+template <typename ArithmeticType = double>
+class ScoreTable {
+
+public:
+  explicit ScoreTable(ArithmeticType defaultScore = 0) {
+    for ( std::size_t i = 0; i < 256; ++i )
+      scores_[i] = defaultScore;
+  }
+
+  // Score each residue in residues, in upper and lower case
+  void Set(const std::string& residues, ArithmeticType score) {
+    for ( std::size_t i = 0; i < residues.size(); ++i ) {
+      unsigned char c = residues[i];
+      scores_[std::toupper(c)] = scores_[std::tolower(c)] = score;
+    } // for
+  }
+
+  ArithmeticType operator[](unsigned char c) const { return(scores_[c]); }
+
+
+private:
+  ArithmeticType scores_[256];
+};
+
+
+//===========================================================================
+// FastaSegment: one maximal scoring subsequence of a FASTA record: residue
+//  positions [first_, last_) of record record_, and its score (the sum of
+//  (score - threshold) over those residues).
+//===========================================================================
+template <typename ArithmeticType = double>
+struct FastaSegment {
+  std::size_t record_, first_, last_;
+  ArithmeticType score_;
+};
+
+
+/*
+ ===========
+ FastaFile :
+ ===========
+  o A memory-mapped FASTA file: records start at lines beginning with '>'.
+     Anything before the first record is ignored.
+  o Records are found with one memchr() pass when the file is opened;
+     sequence bytes are never copied.  Residue positions count every
+     printable byte of a record's sequence lines; line breaks and other
+     whitespace are skipped.
+  o Throws std::runtime_error if the file cannot be opened or mapped.
+*/
+class FastaFile {
+
+public:
+
+  // typedefs
+  typedef std::size_t SizeType;
+
+  struct Record {
+    const char* header_; // just past '>'
+    const char* headerEnd_;
+    const char* sequence_;
+    const char* sequenceEnd_;
+  };
+
+  explicit FastaFile(const std::string& path) : file_(path) {
+    const char* p = file_.Data();
+    const char* end = p + file_.Size();
+    if ( p != end && *p != '>' )
+      p = next(p, end);
+
+    while ( p != end ) {
+      Record r;
+      r.header_ = p + 1;
+      r.headerEnd_ = static_cast<const char*>(
+                       std::memchr(r.header_, '\n', end - r.header_));
+      if ( !r.headerEnd_ )
+        r.headerEnd_ = end;
+      r.sequence_ = (r.headerEnd_ == end) ? end : r.headerEnd_ + 1;
+      p = r.sequenceEnd_ = next(r.sequence_, end);
+      if ( r.headerEnd_ != r.header_ && r.headerEnd_[-1] == '\r' )
+        --r.headerEnd_;
+      records_.push_back(r);
+    } // while
+  }
+
+  SizeType Records() const { return(records_.size()); }
+  const Record& At(SizeType i) const { return(records_[i]); }
+
+  // Whole header line of record i, without the '>'
+  std::string Header(SizeType i) const
+    { return(std::string(records_[i].header_, records_[i].headerEnd_)); }
+
+  // Record i's id: its header up to the first whitespace
+  std::string Id(SizeType i) const {
+    const char* p = records_[i].header_;
+    while ( p != records_[i].headerEnd_ &&
+            !std::isspace(static_cast<unsigned char>(*p)) )
+      ++p;
+    return(std::string(records_[i].header_, p));
+  }
+
+
+private:
+  FastaFile(const FastaFile&); // not copyable
+  FastaFile& operator=(const FastaFile&);
+
+  // Start of the next line that begins with '>', or end
+  static const char* next(const char* p, const char* end) {
+    while ( p != end ) {
+      const char* q = static_cast<const char*>(std::memchr(p, '>', end - p));
+      if ( !q )
+        return(end);
+      if ( q == p || q[-1] == '\n' )
+        return(q);
+      p = q + 1;
+    } // while
+    return(end);
+  }
+
+
+private:
+  MappedFile file_;
+  std::vector<Record> records_;
+};
+
+
+namespace detail {
+
+//===========================================================================
+// FastaStack: candidate store for Insert() that writes each finished
+//  candidate as a FastaSegment, scored from its (L,R) totals.
+//===========================================================================
+template <typename ArithmeticType>
+class FastaStack {
+
+public:
+  typedef Candidate<ArithmeticType> Type;
+
+  explicit FastaStack(std::size_t record) : record_(record) { /* */ }
+
+  std::size_t Size() const { return(stack_.size()); }
+  const Type& At(std::size_t i) const { return(stack_[i]); }
+  void Push(const Type& c) { stack_.push_back(c); }
+  void Truncate(std::size_t sz) { stack_.resize(sz); }
+
+  template <class OutputIterator>
+  void Drain(OutputIterator& out) {
+    FastaSegment<ArithmeticType> s;
+    s.record_ = record_;
+    typename std::vector<Type>::const_iterator i = stack_.begin();
+    while ( i != stack_.end() ) {
+      s.first_ = i->first_;
+      s.last_ = i->last_;
+      s.score_ = i->right_ - i->left_;
+      *out++ = s;
+      ++i;
+    } // while
+    stack_.clear();
+  }
+
+private:
+  std::size_t record_;
+  std::vector<Type> stack_;
+};
+
+
+//===========================================================================
+// FastaJobs: records handed out one at a time to worker threads
+//===========================================================================
+template <typename ArithmeticType>
+struct FastaJobs {
+  typedef std::vector< FastaSegment<ArithmeticType> > ResultType;
+
+  const FastaFile* file_;
+  const ScoreTable<ArithmeticType>* table_;
+  ArithmeticType threshold_;
+  std::vector<ResultType>* results_; // one per record
+  std::size_t next_;
+  pthread_mutex_t mutex_;
+
+  static void Run(void* p);
+};
+
+struct ThreadTask {
+  void (*run_)(void*);
+  void* arg_;
+};
+
+} // namespace detail
+
+} // namespace mss
+
+
+extern "C" {
+  inline void* mss_detail_thread_task(void* p) {
+    mss::detail::ThreadTask* t = static_cast<mss::detail::ThreadTask*>(p);
+    t->run_(t->arg_);
+    return(0);
+  }
+}
+
+
+namespace mss {
+
+/*
+ ================
+ AlgMSSFasta() : one record
+ ================
+  o Same results as AlgMSS() on the record's residues converted to scores
+     with table, but straight from the mapped file: each residue costs one
+     table lookup and no array of scores is made.
+  o Writes a FastaSegment<ArithmeticType> to out for every maximal scoring
+     subsequence, in order.
+*/
+template <class ArithmeticType, class OutputIterator>
+OutputIterator AlgMSSFasta(const FastaFile& file, std::size_t record,
+                           const ScoreTable<ArithmeticType>& table,
+                           OutputIterator out, ArithmeticType threshold) {
+
+  // One subtraction per byte value, not per residue
+  ArithmeticType resid[256];
+  for ( std::size_t i = 0; i < 256; ++i )
+    resid[i] = table[static_cast<unsigned char>(i)] - threshold;
+
+  typedef detail::FastaStack<ArithmeticType> StackType;
+  StackType stack(record);
+  typename StackType::Type c;
+  ArithmeticType total = 0;
+  std::size_t position = 0;
+
+  const FastaFile::Record& r = file.At(record);
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(r.sequence_);
+  const unsigned char* end =
+    reinterpret_cast<const unsigned char*>(r.sequenceEnd_);
+  for ( ; p != end; ++p ) {
+    if ( *p <= ' ' ) // line breaks and other whitespace
+      continue;
+    const ArithmeticType s = resid[*p];
+    if ( s > 0 ) {
+      c.first_ = position;
+      c.last_ = position + 1;
+      c.left_ = total;
+      total += s;
+      c.right_ = total;
+      detail::Insert(stack, c, out);
+    }
+    else
+      total += s;
+    ++position;
+  } // for
+  stack.Drain(out);
+  return(out);
+}
+
+
+/*
+ ================
+ AlgMSSFasta() : every record
+ ================
+  o Runs the single-record AlgMSSFasta() on every record of file, using up
+     to 'threads' threads that each take the next unprocessed record.
+  o Results are written to out in record order once all records are done.
+  o Link with -pthread.
+*/
+template <class ArithmeticType, class OutputIterator>
+OutputIterator AlgMSSFasta(const FastaFile& file,
+                           const ScoreTable<ArithmeticType>& table,
+                           OutputIterator out, ArithmeticType threshold,
+                           std::size_t threads = 1) {
+  typedef detail::FastaJobs<ArithmeticType> JobsType;
+  std::vector<typename JobsType::ResultType> results(file.Records());
+  JobsType jobs;
+  jobs.file_ = &file;
+  jobs.table_ = &table;
+  jobs.threshold_ = threshold;
+  jobs.results_ = &results;
+  jobs.next_ = 0;
+  pthread_mutex_init(&jobs.mutex_, 0);
+
+  detail::ThreadTask task = { &JobsType::Run, &jobs };
+  if ( threads > file.Records() )
+    threads = file.Records();
+  std::vector<pthread_t> ids;
+  for ( std::size_t i = 1; i < threads; ++i ) {
+    pthread_t id;
+    if ( pthread_create(&id, 0, mss_detail_thread_task, &task) == 0 )
+      ids.push_back(id);
+  } // for
+  JobsType::Run(&jobs); // this thread works too
+  for ( std::size_t i = 0; i < ids.size(); ++i )
+    pthread_join(ids[i], 0);
+  pthread_mutex_destroy(&jobs.mutex_);
+
+  for ( std::size_t i = 0; i < results.size(); ++i ) {
+    for ( std::size_t j = 0; j < results[i].size(); ++j )
+      *out++ = results[i][j];
+  } // for
+  return(out);
+}
+
+
+template <typename ArithmeticType>
+void detail::FastaJobs<ArithmeticType>::Run(void* p) {
+  FastaJobs* jobs = static_cast<FastaJobs*>(p);
+  while ( true ) {
+    pthread_mutex_lock(&jobs->mutex_);
+    std::size_t record = jobs->next_++;
+    pthread_mutex_unlock(&jobs->mutex_);
+    if ( record >= jobs->file_->Records() )
+      return;
+
+    ResultType& result = (*jobs->results_)[record];
+    AlgMSSFasta(*jobs->file_, record, *jobs->table_,
+                std::back_inserter(result), jobs->threshold_);
+  } // while
+}
+
+} // namespace mss
+
+#endif // MSS_FASTA_H
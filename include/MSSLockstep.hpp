@@ -0,0 +1,164 @@
+/*
+
+FILE: MSSLockstep.hpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+
+// Macro Guard
+#ifndef MSS_LOCKSTEP_H
+#define MSS_LOCKSTEP_H
+
+// Files included
+#include <cstddef>
+#include <vector>
+
+#include "MSSStack.hpp"
+
+
+namespace mss {
+
+/*
+ ==========
+ Lockstep :
+ ==========
+  o Runs one AlgMSS() per sample over many equal-length tracks at once.
+     Input is consumed one position at a time as a column holding the score
+     of every sample at that position (a samples x positions matrix stored
+     position-major), so each column is read from memory exactly once.
+  o Threshold subtraction and accumulation are done for all samples in one
+     tight loop over contiguous arrays, which the compiler vectorizes; only
+     samples with a positive score at a position go on to steps 1-4.
+  o Results per sample equal those of AlgMSS() on that sample's scores,
+     written as std::pair<std::size_t, std::size_t> positions [first, last).
+  o OutputIterators is a random access sequence holding one OutputIterator
+     per sample, such as a std::vector of std::back_insert_iterator<>'s.  It
+     is taken by reference and its elements are advanced in place, so pass
+     the same sequence to every Push() and to Finish(); iterators that carry
+     their own position (ie; plain pointers into buffers) then keep it.
+*/
+template <typename ArithmeticType = double>
+class Lockstep {
+
+  typedef detail::CandidateStack<ArithmeticType> StackType;
+  typedef typename StackType::Type CandidateType;
+
+
+public:
+
+  // typedefs
+  typedef std::size_t SizeType;
+
+  Lockstep(SizeType samples, ArithmeticType threshold)
+    : position_(0), thresholds_(samples, threshold), resid_(samples, 0),
+      total_(samples, 0), prior_(samples, 0), stacks_(samples)
+    { /* */ }
+
+  template <class InputIterator>
+  Lockstep(InputIterator thresholdBeg, InputIterator thresholdEnd)
+    : position_(0), thresholds_(thresholdBeg, thresholdEnd),
+      resid_(thresholds_.size(), 0), total_(thresholds_.size(), 0),
+      prior_(thresholds_.size(), 0), stacks_(thresholds_.size())
+    { /* */ }
+
+  SizeType Samples() const { return(thresholds_.size()); }
+  SizeType Position() const { return(position_); }
+
+  // Consume column[0] .. column[Samples()-1], all at the next position
+  template <class RandomAccessIterator, class OutputIterators>
+  void Push(RandomAccessIterator column, OutputIterators& outs) {
+    const SizeType sz = thresholds_.size();
+    if ( sz == 0 ) { // nothing to score; &thresholds_[0] is not valid
+      ++position_;
+      return;
+    }
+    const ArithmeticType* thresholds = &thresholds_[0];
+    ArithmeticType* resid = &resid_[0];
+    ArithmeticType* total = &total_[0];
+    ArithmeticType* prior = &prior_[0];
+    for ( SizeType s = 0; s < sz; ++s ) {
+      resid[s] = column[s] - thresholds[s];
+      prior[s] = total[s];
+      total[s] += resid[s];
+    } // for
+
+    CandidateType c;
+    c.first_ = position_;
+    c.last_ = position_ + 1;
+    for ( SizeType s = 0; s < sz; ++s ) {
+      if ( resid[s] > 0 ) {
+        c.left_ = prior[s];
+        c.right_ = total[s];
+        detail::Insert(stacks_[s], c, outs[s]);
+      }
+    } // for
+    ++position_;
+  }
+
+  // Write every remaining candidate; no more columns may follow
+  template <class OutputIterators>
+  void Finish(OutputIterators& outs) {
+    for ( SizeType s = 0; s < stacks_.size(); ++s )
+      stacks_[s].Drain(outs[s]);
+  }
+
+
+private:
+  SizeType position_;
+  std::vector<ArithmeticType> thresholds_, resid_, total_, prior_;
+  std::vector<StackType> stacks_;
+};
+
+
+/*
+ ==================
+ AlgMSSLockstep() :
+ ==================
+  o scores points to a position-major matrix: the score of sample s at
+     position p is scores[p*samples + s].
+  o Equivalent to calling AlgMSS() once per sample with the same threshold.
+  o outs is as for Lockstep<>: one OutputIterator per sample, advanced in
+     place.
+*/
+template <class RandomAccessIterator, class OutputIterators,
+          class ArithmeticType>
+void AlgMSSLockstep(RandomAccessIterator scores, std::size_t samples,
+                    std::size_t positions, OutputIterators& outs,
+                    ArithmeticType threshold) {
+  if ( samples == 0 )
+    return;
+
+  Lockstep<ArithmeticType> engine(samples, threshold);
+  for ( std::size_t p = 0; p < positions; ++p, scores += samples )
+    engine.Push(scores, outs);
+  engine.Finish(outs);
+}
+
+} // namespace mss
+
+#endif // MSS_LOCKSTEP_H
@@ -0,0 +1,142 @@
+/*
+
+FILE: MSSMappedFile.hpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+
+// Macro Guard
+#ifndef MSS_MAPPED_FILE_H
+#define MSS_MAPPED_FILE_H
+
+// Files included
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+// POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace mss {
+
+//===========================================================================
+// MappedFile: read-only memory mapping of an entire file (POSIX).
+//  'access' is passed on to madvise(): Sequential (the default) suits a
+//  track read front to back by AlgMSS(); Random suits a file searched in
+//  place, such as a segment index, where readahead only wastes I/O.
+//  Throws std::runtime_error if the file cannot be opened or mapped.
+//===========================================================================
+class MappedFile {
+
+public:
+  enum Access { Normal, Sequential, Random };
+
+  explicit MappedFile(const std::string& path, Access access = Sequential)
+    : data_(0), size_(0) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if ( fd < 0 )
+      throw std::runtime_error("Unable to open: " + path);
+
+    struct stat st;
+    if ( ::fstat(fd, &st) != 0 ) {
+      ::close(fd);
+      throw std::runtime_error("Unable to stat: " + path);
+    }
+
+    size_ = static_cast<std::size_t>(st.st_size);
+    if ( size_ > 0 ) {
+      void* addr = ::mmap(0, size_, PROT_READ, MAP_SHARED, fd, 0);
+      if ( addr == MAP_FAILED ) {
+        ::close(fd);
+        throw std::runtime_error("Unable to map: " + path);
+      }
+      data_ = static_cast<const char*>(addr);
+      ::madvise(addr, size_, advice(access));
+    }
+    ::close(fd);
+  }
+
+  ~MappedFile() {
+    if ( data_ )
+      ::munmap(const_cast<char*>(data_), size_);
+  }
+
+  const char* Data() const { return(data_); }
+  std::size_t Size() const { return(size_); }
+
+
+private:
+  MappedFile(const MappedFile&); // not copyable
+  MappedFile& operator=(const MappedFile&);
+
+  static int advice(Access access) {
+    if ( access == Sequential )
+      return(MADV_SEQUENTIAL);
+    return(access == Random ? MADV_RANDOM : MADV_NORMAL);
+  }
+
+private:
+  const char* data_;
+  std::size_t size_;
+};
+
+
+//===========================================================================
+// MappedArray<T>: a file of raw, native-endian T's (ie; doubles written
+//  with fwrite()) viewed as a const T* range that may be handed directly
+//  to AlgMSS().  Any trailing partial element is ignored.  See MappedFile
+//  for 'access'.
+//===========================================================================
+template <typename T>
+class MappedArray {
+
+public:
+  typedef const T* ConstIterator;
+
+  explicit MappedArray(const std::string& path,
+                       MappedFile::Access access = MappedFile::Sequential)
+    : file_(path, access)
+    { /* */ }
+
+  ConstIterator Begin() const
+    { return(reinterpret_cast<ConstIterator>(file_.Data())); }
+  ConstIterator End() const { return(Begin() + Size()); }
+  std::size_t Size() const { return(file_.Size() / sizeof(T)); }
+
+
+private:
+  MappedFile file_;
+};
+
+} // namespace mss
+
+#endif // MSS_MAPPED_FILE_H
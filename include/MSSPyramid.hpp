@@ -0,0 +1,322 @@
+/*
+
+FILE: MSSPyramid.hpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+
+// Macro Guard
+#ifndef MSS_PYRAMID_H
+#define MSS_PYRAMID_H
+
+// Files included
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <stdint.h>
+
+#include "MSS.hpp"
+
+
+namespace mss {
+
+/*
+ =========
+ Pyramid :
+ =========
+  o Level h (1 <= h <= Levels()) holds sums of the track's scores over bins of
+     2^h elements: bin i covers track positions [i*2^h, (i+1)*2^h), the last
+     bin possibly being partial.  The track itself is level 0 and is not
+     copied.  All levels together take about Size() values.
+  o A bin's score at a threshold is its sum less threshold times its number
+     of elements, so the MSS of a level are exactly the MSS of the track with
+     both ends of every subsequence restricted to bin boundaries.
+  o 'source' is an identity of the track chosen by the caller (ie; a digest
+     of its bytes).  It is stored by Write(), and reading a pyramid back
+     requires the same value, so a pyramid is never used with a track other
+     than the one it was built from.
+  o Scan() runs coarse-to-fine: MSS over the whole track at level h, then
+     Refine() searches only windows made of the segments found (widened by
+     'pad' of their bins on each side, overlaps joined), either directly on
+     the track with AlgMSS() or first through some finer levels.  Refine()
+     may also be handed just the coarse results that look promising, but
+     the Guarantee below then no longer holds.
+
+  ----------
+  Guarantee
+  ----------
+  Let m be the largest (score - threshold) of any track element.  Every
+   maximal scoring subsequence of the full track whose score exceeds
+   2*(2^h - 1)*m overlaps a maximal scoring subsequence at level h:
+   it spans at least one whole bin, the bins it spans score more than zero
+   (what is left over on either end is shorter than a bin), so one of them
+   is positive, and every positive element lies in some maximal scoring
+   subsequence.  Hence such segments always fall at least partly inside the
+   windows searched at level h-1.
+
+  Results of Refine() are the MSS of each final window which, with the
+   default step, is a coarse segment widened by pad bins on each side.
+   Every result lies inside a window, and it is identical to a
+   full-resolution segment when that segment and its neighborhood fall
+   entirely inside one window; segments that straddle a window edge are
+   clipped there.  The larger 'pad', the rarer that is.
+   pyramid.mss.example1.cpp measures this against a full-resolution
+   AlgMSS() run.
+*/
+template <typename ArithmeticType = double>
+class Pyramid {
+
+public:
+
+  // typedefs
+  typedef std::size_t SizeType;
+  typedef std::pair<SizeType, SizeType> RangeType;
+
+  template <class ForwardIterator>
+  Pyramid(ForwardIterator beg, ForwardIterator end, SizeType levels,
+          uint64_t source = 0)
+    : size_(0), source_(source), levels_(levels) {
+    if ( levels == 0 ) {
+      size_ = std::distance(beg, end);
+      return;
+    }
+
+    std::vector<ArithmeticType>& first = levels_[0];
+    while ( beg != end ) {
+      if ( size_++ % 2 == 0 )
+        first.push_back(*beg++);
+      else
+        first.back() += *beg++;
+    } // while
+
+    for ( SizeType h = 1; h < levels_.size(); ++h ) {
+      const std::vector<ArithmeticType>& lower = levels_[h - 1];
+      std::vector<ArithmeticType>& upper = levels_[h];
+      upper.reserve((lower.size() + 1) / 2);
+      for ( SizeType i = 0; i < lower.size(); i += 2 ) {
+        if ( i + 1 < lower.size() )
+          upper.push_back(lower[i] + lower[i + 1]);
+        else
+          upper.push_back(lower[i]);
+      } // for
+    } // for
+  }
+
+  /*
+    Read a pyramid written by Write() for the track identified by source.
+     Throws std::runtime_error if it was built from a different source.
+  */
+  Pyramid(std::istream& is, uint64_t source) : size_(0), source_(0) {
+    char magic[sizeof(Magic)];
+    SizeType levels = 0;
+    is.read(magic, sizeof(magic));
+    is.read(reinterpret_cast<char*>(&size_), sizeof(size_));
+    is.read(reinterpret_cast<char*>(&levels), sizeof(levels));
+    is.read(reinterpret_cast<char*>(&source_), sizeof(source_));
+    if ( !is || std::memcmp(magic, Magic, sizeof(Magic)) != 0 )
+      throw std::runtime_error("mss::Pyramid: not a pyramid file");
+    if ( source_ != source )
+      throw std::runtime_error("mss::Pyramid: built from a different track");
+
+    levels_.resize(levels);
+    for ( SizeType h = 1; h <= levels; ++h ) {
+      levels_[h - 1].resize(Bins(h));
+      if ( Bins(h) > 0 )
+        is.read(reinterpret_cast<char*>(&levels_[h - 1][0]),
+                Bins(h) * sizeof(ArithmeticType));
+    } // for
+    if ( !is )
+      throw std::runtime_error("mss::Pyramid: truncated pyramid file");
+  }
+
+  /*
+    Native binary layout: magic, Size(), Levels(), Source(), then each
+     level's bins
+  */
+  void Write(std::ostream& os) const {
+    SizeType levels = Levels();
+    os.write(Magic, sizeof(Magic));
+    os.write(reinterpret_cast<const char*>(&size_), sizeof(size_));
+    os.write(reinterpret_cast<const char*>(&levels), sizeof(levels));
+    os.write(reinterpret_cast<const char*>(&source_), sizeof(source_));
+    for ( SizeType h = 1; h <= levels; ++h ) {
+      if ( Bins(h) > 0 )
+        os.write(reinterpret_cast<const char*>(&levels_[h - 1][0]),
+                 Bins(h) * sizeof(ArithmeticType));
+    } // for
+  }
+
+  SizeType Size() const { return(size_); }
+  SizeType Levels() const { return(levels_.size()); }
+  uint64_t Source() const { return(source_); }
+  SizeType Bins(SizeType h) const { return((size_ + width(h) - 1) >> h); }
+
+  // Bin sums at level h, 1 <= h <= Levels()
+  const std::vector<ArithmeticType>& Level(SizeType h) const
+    { return(levels_[h - 1]); }
+
+  /*
+    Writes RangeType track positions [first, last) for the MSS at level h
+     (1 <= h <= Levels()) of the bins covering track positions [first, last).
+  */
+  template <class OutputIterator>
+  OutputIterator Segments(SizeType h, ArithmeticType threshold,
+                          SizeType first, SizeType last,
+                          OutputIterator out) const {
+    const std::vector<ArithmeticType>& level = Level(h);
+    SizeType b0 = first >> h, b1 = (last + width(h) - 1) >> h;
+    std::vector<ArithmeticType> resid;
+    resid.reserve(b1 - b0);
+    for ( SizeType b = b0; b < b1; ++b )
+      resid.push_back(level[b] - threshold * ArithmeticType(count(h, b)));
+    return(segments(resid, h, b0, out));
+  }
+
+  /*
+    Coarse-to-fine refinement of level h subsequences [coarseBeg, coarseEnd),
+     as written by Segments(h, ...), where track is a RandomAccessIterator to
+     the scores this pyramid was built from.  Pass all of them for the
+     Guarantee to hold.  Passing only those that look worth a closer look
+     (ie; the highest scoring ones) is a heuristic: a strong full-resolution
+     segment may overlap only coarse results that were left out.
+     Each round widens the current windows by 'pad' bins of the current
+     level, then searches them 'step' levels finer (0: go straight to the
+     track).  Writes RangeType track positions [first, last), in order.
+  */
+  template <class RandomAccessIterator, class InputIterator,
+            class OutputIterator>
+  OutputIterator Refine(RandomAccessIterator track, SizeType h,
+                        ArithmeticType threshold,
+                        InputIterator coarseBeg, InputIterator coarseEnd,
+                        OutputIterator out,
+                        SizeType pad = 1, SizeType step = 0) const {
+    std::vector<RangeType> windows(coarseBeg, coarseEnd), next;
+    if ( step == 0 || step > h )
+      step = h;
+
+    while ( h > 0 ) {
+      widen(windows, pad * width(h));
+      h = (h > step) ? h - step : 0;
+      if ( h == 0 )
+        break;
+      next.clear();
+      for ( SizeType w = 0; w < windows.size(); ++w )
+        Segments(h, threshold, windows[w].first, windows[w].second,
+                 std::back_inserter(next));
+      windows.swap(next);
+    } // while
+
+    typedef std::pair<RandomAccessIterator, RandomAccessIterator> PairType;
+    std::vector<PairType> found;
+    for ( SizeType w = 0; w < windows.size(); ++w ) {
+      found.clear();
+      AlgMSS(track + windows[w].first, track + windows[w].second,
+             std::back_inserter(found), threshold);
+      for ( SizeType i = 0; i < found.size(); ++i )
+        *out++ = RangeType(found[i].first - track, found[i].second - track);
+    } // for
+    return(out);
+  }
+
+  // Segments() at level h over the whole track followed by Refine()
+  template <class RandomAccessIterator, class OutputIterator>
+  OutputIterator Scan(RandomAccessIterator track, SizeType h,
+                      ArithmeticType threshold, OutputIterator out,
+                      SizeType pad = 1, SizeType step = 0) const {
+    if ( h > Levels() )
+      h = Levels();
+    std::vector<RangeType> coarse;
+    if ( h == 0 )
+      coarse.push_back(RangeType(0, size_));
+    else
+      Segments(h, threshold, 0, size_, std::back_inserter(coarse));
+    return(Refine(track, h, threshold, coarse.begin(), coarse.end(), out,
+                  pad, step));
+  }
+
+
+private:
+
+  static SizeType width(SizeType h) { return(SizeType(1) << h); }
+
+  SizeType count(SizeType h, SizeType bin) const {
+    SizeType b = bin << h;
+    return((size_ - b < width(h)) ? size_ - b : width(h));
+  }
+
+  // MSS of resid, whose elements are level h bins from bin b0 on
+  template <class OutputIterator>
+  OutputIterator segments(std::vector<ArithmeticType>& resid, SizeType h,
+                          SizeType b0, OutputIterator out) const {
+    typedef typename std::vector<ArithmeticType>::iterator IterType;
+    std::vector< std::pair<IterType, IterType> > found;
+    AlgMSS(resid.begin(), resid.end(), std::back_inserter(found),
+           ArithmeticType(0));
+    for ( SizeType i = 0; i < found.size(); ++i ) {
+      SizeType s = (b0 + (found[i].first - resid.begin())) << h;
+      SizeType e = (b0 + (found[i].second - resid.begin())) << h;
+      *out++ = RangeType(s, e < size_ ? e : size_);
+    } // for
+    return(out);
+  }
+
+  // Widen ordered ranges by amt on each side, clip, and join overlaps
+  void widen(std::vector<RangeType>& v, SizeType amt) const {
+    SizeType j = 0;
+    for ( SizeType i = 0; i < v.size(); ++i ) {
+      RangeType r(v[i].first > amt ? v[i].first - amt : 0,
+                  (size_ - v[i].second > amt) ? v[i].second + amt : size_);
+      if ( j > 0 && r.first <= v[j - 1].second )
+        v[j - 1].second = r.second;
+      else
+        v[j++] = r;
+    } // for
+    v.resize(j);
+  }
+
+
+private:
+  static const char Magic[8];
+
+  SizeType size_;
+  uint64_t source_;
+  std::vector< std::vector<ArithmeticType> > levels_; // levels_[h-1]
+};
+
+template <typename ArithmeticType>
+const char Pyramid<ArithmeticType>::Magic[8] =
+  { 'M', 'S', 'S', 'P', 'Y', 'R', '2', '\0' };
+
+} // namespace mss
+
+#endif // MSS_PYRAMID_H
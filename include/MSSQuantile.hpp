@@ -0,0 +1,234 @@
+/*
+
+FILE: MSSQuantile.hpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+
+// Macro Guard
+#ifndef MSS_QUANTILE_H
+#define MSS_QUANTILE_H
+
+// Files included
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+
+namespace mss {
+
+/*
+ ================
+ QuantileSketch :
+ ================
+  o Estimates quantiles of a stream in one pass with bounded memory, for use
+     as AlgMSS()'s threshold (ie; the median of all-positive data) without
+     first copying and reordering the whole track for nth_element().
+  o Values are buffered at level 0.  When a level holds k values it is sorted
+     and every other value is promoted to the next level, where each value
+     stands for twice as many inputs.  The kept half alternates between odd
+     and even positions from one compaction to the next.
+  o Memory: at most k values per level and log2(n/k)+1 levels for n inputs.
+  o Rank error: each compaction at level h moves the rank of any value by at
+     most 2^h.  RankError() is the sum of these over all compactions so far,
+     so the rank of Quantile(q) among all inputs is guaranteed to be within
+     RankError() + MaxWeight() of floor(q*n).  The worst case is about
+     n*log2(n/k)/k; in practice alternating keeps the error far smaller.
+  o Sketches of separate pieces of a track may be combined with Merge(),
+     with the error bounds adding.
+*/
+template <typename T = double>
+class QuantileSketch {
+
+public:
+
+  // typedefs
+  typedef std::size_t SizeType;
+
+  explicit QuantileSketch(SizeType k = 4096)
+    : k_(k < 2 ? 2 : k), count_(0), error_(0)
+    { /* */ }
+
+  void Add(const T& value) {
+    if ( levels_.empty() )
+      grow(1);
+    levels_[0].push_back(value);
+    ++count_;
+    if ( levels_[0].size() >= k_ )
+      compact(0);
+  }
+
+  template <class InputIterator>
+  void Add(InputIterator beg, InputIterator end) {
+    while ( beg != end )
+      Add(*beg++);
+  }
+
+  void Merge(const QuantileSketch& other) {
+    if ( levels_.size() < other.levels_.size() )
+      grow(other.levels_.size());
+    for ( SizeType h = 0; h < other.levels_.size(); ++h )
+      levels_[h].insert(levels_[h].end(), other.levels_[h].begin(),
+                        other.levels_[h].end());
+    count_ += other.count_;
+    error_ += other.error_;
+    for ( SizeType h = 0; h < levels_.size(); ++h ) {
+      if ( levels_[h].size() >= k_ )
+        compact(h);
+    } // for
+  }
+
+  SizeType Count() const { return(count_); }
+  SizeType RankError() const { return(error_); }
+
+  // Number of inputs represented by one value at the highest level
+  SizeType MaxWeight() const {
+    return(levels_.empty() ? 1 : SizeType(1) << (levels_.size() - 1));
+  }
+
+  // Value of estimated 0-based rank 'rank'; Count() must be nonzero
+  T Rank(SizeType rank) const {
+    typedef std::pair<T, SizeType> WeightedValue;
+    std::vector<WeightedValue> all;
+    for ( SizeType h = 0; h < levels_.size(); ++h ) {
+      for ( SizeType i = 0; i < levels_[h].size(); ++i )
+        all.push_back(std::make_pair(levels_[h][i], SizeType(1) << h));
+    } // for
+    std::sort(all.begin(), all.end());
+
+    SizeType cumulative = 0;
+    for ( SizeType i = 0; i < all.size(); ++i ) {
+      cumulative += all[i].second;
+      if ( cumulative > rank )
+        return(all[i].first);
+    } // for
+    return(all.back().first);
+  }
+
+  // Estimate of the value at 0-based rank floor(q*Count()), 0 <= q <= 1
+  T Quantile(double q) const { return(Rank(QuantileRank(q, count_))); }
+
+  static SizeType QuantileRank(double q, SizeType n) {
+    if ( q <= 0 || n == 0 )
+      return(0);
+    SizeType r = static_cast<SizeType>(q * n);
+    return(r < n ? r : n - 1);
+  }
+
+
+private:
+
+  void grow(SizeType levels) {
+    levels_.resize(levels);
+    parity_.resize(levels, false);
+  }
+
+  void compact(SizeType h) {
+    if ( h + 1 == levels_.size() )
+      grow(h + 2);
+
+    std::vector<T>& level = levels_[h];
+    std::sort(level.begin(), level.end());
+    SizeType even = level.size() - level.size() % 2; // odd one out stays
+    for ( SizeType i = (parity_[h] ? 1 : 0); i < even; i += 2 )
+      levels_[h + 1].push_back(level[i]);
+    level.erase(level.begin(), level.begin() + even);
+    parity_[h] = !parity_[h];
+    error_ += SizeType(1) << h;
+
+    if ( levels_[h + 1].size() >= k_ )
+      compact(h + 1);
+  }
+
+
+private:
+  SizeType k_, count_, error_;
+  std::vector< std::vector<T> > levels_;
+  std::vector<bool> parity_;
+};
+
+
+/*
+ =================
+ ExactQuantile() : value of 0-based rank floor(q*n) among [beg, end)
+ =================
+  o Two passes over [beg, end), which is left unchanged: the first builds a
+     QuantileSketch; the second counts values below a bracket guaranteed by
+     the sketch's error bound and keeps only the values inside it.  Memory
+     is O(k) for the sketch plus the bracket, roughly 2*n*log2(n/k)/k values
+     at worst - never a copy of the whole range.
+  o A ForwardIterator is required since the range is read twice, which suits
+     a memory mapped track (see MSSMappedFile.hpp).
+  o Returns the same value as nth_element() would on a copy of the range;
+     the range must not be empty.
+*/
+template <class ForwardIterator>
+typename std::iterator_traits<ForwardIterator>::value_type
+ExactQuantile(ForwardIterator beg, ForwardIterator end, double q,
+              std::size_t k = 4096) {
+  typedef typename std::iterator_traits<ForwardIterator>::value_type T;
+  typedef typename QuantileSketch<T>::SizeType SizeType;
+
+  QuantileSketch<T> sketch(k);
+  sketch.Add(beg, end);
+
+  const SizeType n = sketch.Count();
+  const SizeType r = QuantileSketch<T>::QuantileRank(q, n);
+  const SizeType slack = sketch.RankError() + sketch.MaxWeight();
+  bool haveLo = r > slack, haveHi = r + slack < n;
+  T lo = haveLo ? sketch.Rank(r - slack) : T();
+  T hi = haveHi ? sketch.Rank(r + slack) : T();
+
+  std::vector<T> bracket;
+  while ( true ) {
+    SizeType below = 0;
+    bracket.clear();
+    for ( ForwardIterator i = beg; i != end; ++i ) {
+      if ( haveLo && *i < lo )
+        ++below;
+      else if ( !(haveHi && hi < *i) )
+        bracket.push_back(*i);
+    } // for
+
+    if ( below > r ) // cannot happen within the error bound; widen & retry
+      haveLo = false;
+    else if ( r >= below + bracket.size() )
+      haveHi = false;
+    else {
+      typename std::vector<T>::iterator mid = bracket.begin() + (r - below);
+      std::nth_element(bracket.begin(), mid, bracket.end());
+      return(*mid);
+    }
+  } // while
+}
+
+} // namespace mss
+
+#endif // MSS_QUANTILE_H
@@ -0,0 +1,292 @@
+/*
+
+FILE: MSSRangeIndex.hpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+
+// Macro Guard
+#ifndef MSS_RANGE_INDEX_H
+#define MSS_RANGE_INDEX_H
+
+// Files included
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+
+namespace mss {
+
+namespace detail {
+
+//=================================================================
+// RangeSummary: describes a run of prefix positions [lo, hi] by
+//  its rightmost minimum, its leftmost maximum and one pair
+//  (bestFirst_ <= bestLast_) maximizing P[bestLast_]-P[bestFirst_].
+//  All members equal NoPos() for an empty summary.
+//=================================================================
+struct RangeSummary {
+  static std::size_t NoPos() { return(static_cast<std::size_t>(-1)); }
+
+  RangeSummary()
+    : min_(NoPos()), max_(NoPos()), bestFirst_(NoPos()), bestLast_(NoPos())
+    { /* */ }
+
+  explicit RangeSummary(std::size_t pos)
+    : min_(pos), max_(pos), bestFirst_(pos), bestLast_(pos)
+    { /* */ }
+
+  bool Empty() const { return(min_ == NoPos()); }
+
+  std::size_t min_, max_, bestFirst_, bestLast_;
+};
+
+/*
+ ===========
+ Combine() : summary of run a followed immediately by run b
+ ===========
+  o Prefix must provide operator()(std::size_t) returning the cumulative
+     total at a prefix position.
+*/
+template <class Prefix>
+RangeSummary Combine(const Prefix& p, const RangeSummary& a,
+                     const RangeSummary& b) {
+  if ( a.Empty() )
+    return(b);
+  if ( b.Empty() )
+    return(a);
+
+  RangeSummary s;
+  s.min_ = (p(b.min_) <= p(a.min_)) ? b.min_ : a.min_;
+  s.max_ = (p(a.max_) >= p(b.max_)) ? a.max_ : b.max_;
+  s.bestFirst_ = a.bestFirst_;
+  s.bestLast_ = a.bestLast_;
+  if ( p(b.bestLast_) - p(b.bestFirst_) > p(s.bestLast_) - p(s.bestFirst_) ) {
+    s.bestFirst_ = b.bestFirst_;
+    s.bestLast_ = b.bestLast_;
+  }
+  if ( p(b.max_) - p(a.min_) > p(s.bestLast_) - p(s.bestFirst_) ) {
+    s.bestFirst_ = a.min_;
+    s.bestLast_ = b.max_;
+  }
+  return(s);
+}
+
+/*
+ =============
+ Decompose() : all maximal scoring subsequences within elements [lo, hi)
+ =============
+  o Source must provide Summarize(lo, hi), returning the RangeSummary of prefix
+     positions [lo, hi], and Prefix(), returning a Prefix as used in Combine().
+  o Segments are written in order as std::pair<std::size_t, std::size_t>.
+  o Uses the recursive characterization of Ruzzo and Tompa: the best segment
+     of a window is maximal, and the remaining maximal segments are those of
+     the pieces to its left and right.  The best segment found is trimmed so
+     that its left end is the rightmost minimum and its right end the leftmost
+     maximum, which is how AlgMSS() breaks ties between equal-scoring choices.
+     Each segment costs a constant number of Summarize() calls.
+*/
+template <class Source, class OutputIterator>
+OutputIterator Decompose(const Source& src, std::size_t lo, std::size_t hi,
+                         OutputIterator out) {
+  typedef std::pair<std::size_t, std::size_t> Range;
+  typedef std::pair<Range, bool> Work; // bool: true if Range is a result
+
+  std::vector<Work> todo;
+  todo.push_back(std::make_pair(std::make_pair(lo, hi), false));
+  while ( !todo.empty() ) {
+    Work w = todo.back();
+    todo.pop_back();
+    if ( w.second ) {
+      *out++ = w.first;
+      continue;
+    }
+    else if ( w.first.second <= w.first.first )
+      continue;
+
+    RangeSummary s = src.Summarize(w.first.first, w.first.second);
+    if ( !(src.Prefix()(s.bestLast_) - src.Prefix()(s.bestFirst_) > 0) )
+      continue;
+
+    std::size_t i = src.Summarize(w.first.first, s.bestLast_).min_;
+    std::size_t j = src.Summarize(i, w.first.second).max_;
+    todo.push_back(std::make_pair(std::make_pair(j, w.first.second), false));
+    todo.push_back(std::make_pair(std::make_pair(i, j), true));
+    todo.push_back(std::make_pair(std::make_pair(w.first.first, i), false));
+  } // while
+  return(out);
+}
+
+} // namespace detail
+
+
+
+/*
+ ============
+ RangeIndex :
+ ============
+  o Built once per track and threshold; answers "all maximal scoring
+     subsequences of elements [first, last)" without copying the window or
+     rescanning it.  Results equal those of AlgMSS() run on the window alone.
+  o A query costs O(k * (blockSize + log(n/blockSize))) for k segments found,
+     independent of the window length.
+  o Memory is bounded by:
+      (n+1) * sizeof(ArithmeticType)                 : cumulative totals
+    + (2*ceil((n+1)/blockSize) - 1) * 4*sizeof(size_t) : block summary tree
+     where n is the track length.  With doubles and the default blockSize
+     of 64, that is 9 bytes per element on an LP64 system.
+  o Totals are accumulated from the start of the track rather than from the
+     start of each window.  For integral scores the results are identical to
+     AlgMSS(); for floating point scores, windows containing exact ties may be
+     split differently because of rounding.
+*/
+template <typename ArithmeticType = double>
+class RangeIndex {
+
+  struct PrefixFunctor {
+    explicit PrefixFunctor(const std::vector<ArithmeticType>& p) : p_(p)
+      { /* */ }
+    ArithmeticType operator()(std::size_t i) const { return(p_[i]); }
+    const std::vector<ArithmeticType>& p_;
+  };
+
+
+public:
+
+  // typedefs
+  typedef std::size_t SizeType;
+  typedef std::pair<SizeType, SizeType> RangeType;
+
+  template <class ForwardIterator>
+  RangeIndex(ForwardIterator beg, ForwardIterator end,
+             ArithmeticType threshold, SizeType blockSize = 64)
+    : blockSize_(blockSize > 0 ? blockSize : 1), prefix_(1, 0) {
+    prefix_.reserve(std::distance(beg, end) + 1); // exact, see Memory()
+    ArithmeticType total = 0;
+    while ( beg != end ) {
+      total += *beg++ - threshold;
+      prefix_.push_back(total);
+    } // while
+
+    SizeType blocks = (prefix_.size() + blockSize_ - 1) / blockSize_;
+    tree_.resize(2 * blocks - 1);
+    build(0, 0, blocks);
+  }
+
+  // Number of elements in the track
+  SizeType Size() const { return(prefix_.size() - 1); }
+
+  // Sum of (score - threshold) over elements [first, last)
+  ArithmeticType Score(SizeType first, SizeType last) const
+    { return(prefix_[last] - prefix_[first]); }
+
+  // Bytes held by the index
+  SizeType Memory() const {
+    return(prefix_.capacity() * sizeof(ArithmeticType) +
+           tree_.capacity() * sizeof(detail::RangeSummary));
+  }
+
+  // Writes RangeType results, in order, for elements [first, last)
+  template <class OutputIterator>
+  OutputIterator Query(SizeType first, SizeType last,
+                       OutputIterator out) const {
+    if ( last > Size() )
+      last = Size();
+    if ( first >= last )
+      return(out);
+    return(detail::Decompose(*this, first, last, out));
+  }
+
+  // Used by detail::Decompose()
+  PrefixFunctor Prefix() const { return(PrefixFunctor(prefix_)); }
+
+  detail::RangeSummary Summarize(SizeType lo, SizeType hi) const {
+    SizeType bl = lo / blockSize_, bh = hi / blockSize_;
+    if ( bl == bh )
+      return(scan(lo, hi));
+
+    detail::RangeSummary s = scan(lo, (bl + 1) * blockSize_ - 1);
+    if ( bl + 1 < bh ) {
+      SizeType blocks = (prefix_.size() + blockSize_ - 1) / blockSize_;
+      s = detail::Combine(Prefix(), s, query(0, 0, blocks, bl + 1, bh));
+    }
+    return(detail::Combine(Prefix(), s, scan(bh * blockSize_, hi)));
+  }
+
+
+private:
+
+  detail::RangeSummary scan(SizeType lo, SizeType hi) const {
+    detail::RangeSummary s(lo);
+    for ( SizeType i = lo + 1; i <= hi; ++i )
+      s = detail::Combine(Prefix(), s, detail::RangeSummary(i));
+    return(s);
+  }
+
+  // Node layout: node covers blocks [b, e); its left child is node+1 and
+  //  its right child follows the left child's 2*(mid-b)-1 nodes.
+  void build(SizeType node, SizeType b, SizeType e) {
+    if ( e - b == 1 ) {
+      SizeType hi = (b + 1) * blockSize_ - 1;
+      if ( hi >= prefix_.size() )
+        hi = prefix_.size() - 1;
+      tree_[node] = scan(b * blockSize_, hi);
+      return;
+    }
+    SizeType mid = b + (e - b) / 2;
+    SizeType left = node + 1, right = node + 2 * (mid - b);
+    build(left, b, mid);
+    build(right, mid, e);
+    tree_[node] = detail::Combine(Prefix(), tree_[left], tree_[right]);
+  }
+
+  detail::RangeSummary query(SizeType node, SizeType b, SizeType e,
+                             SizeType qb, SizeType qe) const {
+    if ( qb <= b && e <= qe )
+      return(tree_[node]);
+    SizeType mid = b + (e - b) / 2;
+    detail::RangeSummary s;
+    if ( qb < mid )
+      s = query(node + 1, b, mid, qb, qe);
+    if ( qe > mid )
+      s = detail::Combine(Prefix(), s,
+                          query(node + 2 * (mid - b), mid, e, qb, qe));
+    return(s);
+  }
+
+
+private:
+  SizeType blockSize_;
+  std::vector<ArithmeticType> prefix_;
+  std::vector<detail::RangeSummary> tree_;
+};
+
+} // namespace mss
+
+#endif // MSS_RANGE_INDEX_H
@@ -0,0 +1,323 @@
+/*
+
+FILE: MSSSegmentIndex.hpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+
+// Macro Guard
+#ifndef MSS_SEGMENT_INDEX_H
+#define MSS_SEGMENT_INDEX_H
+
+// Files included
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "MSSMappedFile.hpp"
+
+
+/*
+  A segment index is a file of maximal scoring subsequences - disjoint,
+   ordered ranges [first, last) of one track, each with its score - laid out
+   so that it can be memory mapped and searched in place:
+
+     header : magic "MSSSEG1\0", then 64-bit record count, fence stride and
+               fence count
+     records: one 24-byte record per segment (64-bit first, 64-bit last,
+               double score), in order
+     fences : the first position of every stride'th record
+
+  Sizes and doubles use the machine's native layout, like the tracks.
+*/
+
+namespace mss {
+
+//===========================================================================
+// IndexedSegment: one record of a segment index
+//===========================================================================
+struct IndexedSegment {
+  uint64_t first_, last_;
+  double score_;
+};
+
+
+namespace detail {
+
+  struct SegmentIndexHeader {
+    char magic_[8];
+    uint64_t count_, stride_, fences_;
+  };
+
+  inline const char* SegmentIndexMagic() { return("MSSSEG1"); }
+
+} // namespace detail
+
+
+/*
+ ====================
+ SegmentIndexWriter :
+ ====================
+  o Writes a segment index to path, one Add() at a time, so results can be
+     streamed from AlgMSS() without holding them all.  Only the fence table
+     (one position per 'stride' records) is kept in memory until Close().
+  o Segments must be added in order and may not overlap, as AlgMSS()
+     writes them.
+  o Throws std::runtime_error if the file cannot be written or a segment is
+     out of order.  The file is complete only after Close() (also called by
+     the destructor, where errors are ignored).
+*/
+class SegmentIndexWriter {
+
+public:
+
+  // typedefs
+  typedef std::size_t SizeType;
+
+  explicit SegmentIndexWriter(const std::string& path, SizeType stride = 64)
+    : path_(path), fp_(std::fopen(path.c_str(), "wb")),
+      stride_(stride ? stride : 1), count_(0), last_(0) {
+    if ( !fp_ )
+      throw std::runtime_error("mss::SegmentIndexWriter: unable to write: " +
+                               path_);
+    detail::SegmentIndexHeader h;
+    std::memset(&h, 0, sizeof(h));
+    write(&h, sizeof(h)); // filled in by Close()
+  }
+
+  ~SegmentIndexWriter() {
+    try {
+      Close();
+    } catch(...) { /* */ }
+  }
+
+  void Add(uint64_t first, uint64_t last, double score) {
+    if ( last <= first || (count_ > 0 && first < last_) )
+      throw std::runtime_error("mss::SegmentIndexWriter: segments must be "
+                               "non-empty, ordered and disjoint: " + path_);
+    if ( count_ % stride_ == 0 )
+      fences_.push_back(first);
+    IndexedSegment s = { first, last, score };
+    write(&s, sizeof(s));
+    ++count_;
+    last_ = last;
+  }
+
+  SizeType Size() const { return(count_); }
+
+  // Append the fence table and fill in the header
+  void Close() {
+    if ( !fp_ )
+      return;
+    if ( !fences_.empty() )
+      write(&fences_[0], fences_.size() * sizeof(uint64_t));
+
+    detail::SegmentIndexHeader h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic_, detail::SegmentIndexMagic(), sizeof(h.magic_));
+    h.count_ = count_;
+    h.stride_ = stride_;
+    h.fences_ = fences_.size();
+    bool ok = (std::fseek(fp_, 0, SEEK_SET) == 0);
+    if ( ok )
+      write(&h, sizeof(h));
+    ok = (std::fclose(fp_) == 0) && ok;
+    fp_ = 0;
+    if ( !ok )
+      throw std::runtime_error("mss::SegmentIndexWriter: unable to write: " +
+                               path_);
+  }
+
+
+private:
+  SegmentIndexWriter(const SegmentIndexWriter&); // not copyable
+  SegmentIndexWriter& operator=(const SegmentIndexWriter&);
+
+  void write(const void* p, SizeType n) {
+    if ( std::fwrite(p, 1, n, fp_) != n ) {
+      std::fclose(fp_);
+      fp_ = 0;
+      throw std::runtime_error("mss::SegmentIndexWriter: unable to write: " +
+                               path_);
+    }
+  }
+
+
+private:
+  std::string path_;
+  std::FILE* fp_;
+  SizeType stride_, count_;
+  uint64_t last_;
+  std::vector<uint64_t> fences_;
+};
+
+
+/*
+ ==============
+ SegmentIndex :
+ ==============
+  o Reads a segment index in place through a memory mapping: opening one
+     costs a few system calls and no parsing, whatever its size.  The
+     mapping is advised as random access, so lookups on a cold index fault
+     in only the pages they touch.
+  o A lookup binary searches the fence table, which is small enough to stay
+     in cache, and then the 'stride' records of one block.
+  o Lookups return record numbers; Size() means "none".
+  o Throws std::runtime_error if the file cannot be mapped or is not a
+     complete segment index.
+*/
+class SegmentIndex {
+
+public:
+
+  // typedefs
+  typedef std::size_t SizeType;
+
+  explicit SegmentIndex(const std::string& path)
+    : file_(path, MappedFile::Random), count_(0), stride_(1), fences_(0),
+      records_(0), fence_(0) {
+    detail::SegmentIndexHeader h;
+    if ( file_.Size() < sizeof(h) )
+      throw std::runtime_error("mss::SegmentIndex: not a segment index: " +
+                               path);
+    std::memcpy(&h, file_.Data(), sizeof(h));
+    if ( std::memcmp(h.magic_, detail::SegmentIndexMagic(),
+                     sizeof(h.magic_)) != 0 || h.stride_ == 0 ||
+         h.fences_ != (h.count_ + h.stride_ - 1) / h.stride_ ||
+         file_.Size() != sizeof(h) + h.count_ * sizeof(IndexedSegment) +
+                         h.fences_ * sizeof(uint64_t) )
+      throw std::runtime_error("mss::SegmentIndex: not a segment index: " +
+                               path);
+
+    count_ = h.count_;
+    stride_ = h.stride_;
+    fences_ = h.fences_;
+    records_ = reinterpret_cast<const IndexedSegment*>(file_.Data() +
+                                                        sizeof(h));
+    fence_ = reinterpret_cast<const uint64_t*>(records_ + count_);
+  }
+
+  SizeType Size() const { return(count_); }
+  const IndexedSegment& At(SizeType i) const { return(records_[i]); }
+
+  // The record covering position p, or Size()
+  SizeType Find(uint64_t p) const {
+    SizeType i = Lower(p);
+    return((i != count_ && records_[i].first_ <= p) ? i : count_);
+  }
+
+  // The first record ending after position p (ie; covering or following
+  //  p), or Size()
+  SizeType Lower(uint64_t p) const {
+    const uint64_t* f = std::upper_bound(fence_, fence_ + fences_, p);
+    if ( f == fence_ )
+      return(0);
+    SizeType lo = (f - fence_ - 1) * stride_;
+    SizeType hi = std::min(lo + stride_, count_);
+    return(lower(p, lo, hi));
+  }
+
+  /*
+    Writes the record number of each record overlapping [first, last), in
+     order, to out.
+  */
+  template <class OutputIterator>
+  OutputIterator Overlaps(uint64_t first, uint64_t last,
+                          OutputIterator out) const {
+    for ( SizeType i = Lower(first);
+          i != count_ && records_[i].first_ < last; ++i )
+      *out++ = i;
+    return(out);
+  }
+
+  /*
+    Find() for each position in [beg, end), writing one record number (or
+     Size()) per position to out.  Sorted positions are searched forward
+     from the previous answer, so a batch costs far less than as many
+     separate Find() calls; unsorted positions are answered correctly too.
+  */
+  template <class InputIterator, class OutputIterator>
+  OutputIterator Find(InputIterator beg, InputIterator end,
+                      OutputIterator out) const {
+    SizeType i = 0;
+    uint64_t prev = 0;
+    for ( ; beg != end; ++beg ) {
+      uint64_t p = *beg;
+      if ( p < prev || i == count_ )
+        i = Lower(p);
+      else
+        i = gallop(p, i);
+      prev = p;
+      *out++ = (i != count_ && records_[i].first_ <= p) ? i : count_;
+    } // for
+    return(out);
+  }
+
+
+private:
+
+  // First record in [lo, hi) with last_ > p, or hi
+  SizeType lower(uint64_t p, SizeType lo, SizeType hi) const {
+    while ( lo < hi ) {
+      SizeType mid = lo + (hi - lo) / 2;
+      if ( records_[mid].last_ <= p )
+        lo = mid + 1;
+      else
+        hi = mid;
+    } // while
+    return(lo);
+  }
+
+  // Lower(p), given that records before i end at or before p
+  SizeType gallop(uint64_t p, SizeType i) const {
+    SizeType step = 1, lo = i;
+    while ( i < count_ && records_[i].last_ <= p ) {
+      lo = i + 1;
+      i += step;
+      step *= 2;
+    } // while
+    return(lower(p, lo, std::min(i, count_)));
+  }
+
+
+private:
+  MappedFile file_;
+  SizeType count_, stride_, fences_;
+  const IndexedSegment* records_;
+  const uint64_t* fence_;
+};
+
+} // namespace mss
+
+#endif // MSS_SEGMENT_INDEX_H
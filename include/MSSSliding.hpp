@@ -0,0 +1,422 @@
+/*
+
+FILE: MSSSliding.hpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+
+// Macro Guard
+#ifndef MSS_SLIDING_H
+#define MSS_SLIDING_H
+
+// Files included
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "MSSRangeIndex.hpp"
+#include "MSSStack.hpp"
+
+
+namespace mss {
+
+/*
+ ===============
+ SlidingWindow :
+ ===============
+  o Maximal scoring subsequences of the trailing window of the last
+     Window() scores of a stream, kept up to date as scores arrive.  After
+     any number of Push() calls, Segments() writes the same results as
+     AlgMSS() run on the window alone, as std::pair<std::size_t,
+     std::size_t> stream positions [first, last).
+  o New scores on the right go through steps 1-4 of the paper, as in
+     AlgMSS(), except that nothing is ever written out: the candidates held
+     are always exactly the maximal scoring subsequences of the window.
+  o Scores leaving on the left are dropped when Segments() (or Update())
+     is next called.  Segments wholly left of the window are discarded.  At
+     most one segment straddles the window's new start, and the maximal
+     scoring subsequences of the window are the untouched ones plus those
+     of that segment's surviving part; these are found with the recursive
+     decomposition used by RangeIndex<>, over block summaries of the
+     cumulative totals.  Every other segment keeps its place.
+  o Changes() writes only what differs from its previous call: segments
+     that left the results and segments that joined them.  Results change
+     only at the two ends of the window, and each change is noted as it
+     happens, so no comparison of whole windows is needed.
+  o Amortized cost per score is constant plus the step 1 search, as in
+     AlgMSS(); each Update() adds O(k * (blockSize + log(Window()))) for k
+     segments replacing the straddling one.  Calling Changes() every S
+     scores therefore costs O(S) plus the changed output (times log(k) to
+     order the removed segments); Segments() adds the whole window's
+     results, every time.
+  o Memory is bounded by about 2*Window() cumulative totals plus the
+     current candidates, whatever the length of the stream.
+  o As with RangeIndex<>, totals run from an earlier point than each
+     window's start (they are rebased now and then), so results equal
+     AlgMSS()'s exactly for integral scores; for floating point scores,
+     windows with exact ties may be split differently because of rounding.
+*/
+template <typename ArithmeticType = double>
+class SlidingWindow {
+
+  typedef detail::Candidate<ArithmeticType> CandidateType;
+
+  // A candidate, numbered in order of creation for Changes()
+  struct Entry : public CandidateType {
+    std::size_t serial_;
+  };
+
+  struct PrefixFunctor {
+    PrefixFunctor(const std::vector<ArithmeticType>& p, std::size_t mask)
+      : p_(p), mask_(mask)
+      { /* */ }
+    ArithmeticType operator()(std::size_t i) const { return(p_[i & mask_]); }
+    const std::vector<ArithmeticType>& p_;
+    std::size_t mask_;
+  };
+
+
+public:
+
+  // typedefs
+  typedef std::size_t SizeType;
+  typedef std::pair<SizeType, SizeType> RangeType;
+
+  SlidingWindow(SizeType window, ArithmeticType threshold,
+                SizeType blockSize = 64)
+    : window_(window ? window : 1), threshold_(threshold), position_(0),
+      start_(0), rebased_(0), front_(0), serial_(0), mark_(0) {
+    blockSize_ = 2;
+    while ( blockSize_ < blockSize )
+      blockSize_ *= 2;
+    SizeType cap = blockSize_;
+    while ( cap < 2 * window_ + 2 * blockSize_ + 2 )
+      cap *= 2;
+    prefix_.resize(cap, 0);
+    blocks_ = cap / blockSize_;
+    tree_.resize(2 * blocks_);
+  }
+
+  SizeType Window() const { return(window_); }
+
+  // Number of scores pushed so far; the window ends here
+  SizeType Position() const { return(position_); }
+
+  // First position of the window
+  SizeType Start() const
+    { return(position_ > window_ ? position_ - window_ : 0); }
+
+  void Push(ArithmeticType score) {
+    const ArithmeticType prior = prefix(position_);
+    const ArithmeticType resid = score - threshold_;
+    const ArithmeticType total = prior + resid;
+    ++position_;
+    prefix_[position_ & mask()] = total;
+    if ( (position_ + 1) % blockSize_ == 0 )
+      summarize(position_ / blockSize_);
+
+    if ( resid > 0 ) {
+      CandidateType c;
+      c.first_ = position_ - 1;
+      c.last_ = position_;
+      c.left_ = prior;
+      c.right_ = total;
+      insert(c);
+    }
+
+    if ( position_ - start_ >= 2 * window_ )
+      Update(); // keep memory bounded
+  }
+
+  template <class InputIterator>
+  void Push(InputIterator beg, InputIterator end) {
+    while ( beg != end )
+      Push(*beg++);
+  }
+
+  // Drop whatever has left the window
+  void Update() {
+    const SizeType k = Start();
+    if ( k <= start_ )
+      return;
+    start_ = k;
+
+    while ( !stack_.empty() && stack_.front().last_ <= k ) {
+      dropped(stack_.front());
+      stack_.pop_front();
+      ++front_;
+    } // while
+
+    if ( !stack_.empty() && stack_.front().first_ < k )
+      replaceFront(k);
+
+    if ( start_ - rebased_ >= prefix_.size() / 2 )
+      rebase();
+  }
+
+  // Number of maximal scoring subsequences in the window
+  SizeType Size() {
+    Update();
+    return(stack_.size());
+  }
+
+  // Writes RangeType results for the current window, in order
+  template <class OutputIterator>
+  OutputIterator Segments(OutputIterator out) {
+    Update();
+    typename std::deque<Entry>::const_iterator i = stack_.begin();
+    for ( ; i != stack_.end(); ++i )
+      *out++ = RangeType(i->first_, i->last_);
+    return(out);
+  }
+
+  /*
+    Writes RangeType results of the previous call (none, the first time)
+     that are no longer results to removed, and current results that were
+     not results then to added, each in order.  Once it has been called,
+     removed results are held until the next call, so call it at every step.
+  */
+  template <class OutputIterator1, class OutputIterator2>
+  void Changes(OutputIterator1 removed, OutputIterator2 added) {
+    Update();
+    std::sort(removed_.begin(), removed_.end());
+    for ( SizeType i = 0; i < removed_.size(); ++i )
+      *removed++ = removed_[i];
+    removed_.clear();
+
+    // new ones sit at either end: replacements in front, arrivals in back
+    SizeType f = 0, b = stack_.size();
+    while ( f < b && stack_[f].serial_ >= mark_ )
+      ++f;
+    while ( b > f && stack_[b - 1].serial_ >= mark_ )
+      --b;
+    for ( SizeType i = 0; i < f; ++i )
+      *added++ = RangeType(stack_[i].first_, stack_[i].last_);
+    for ( SizeType i = b; i < stack_.size(); ++i )
+      *added++ = RangeType(stack_[i].first_, stack_[i].last_);
+    mark_ = serial_;
+  }
+
+  // Sum of (score - threshold) over positions [first, last) of the window
+  ArithmeticType Score(SizeType first, SizeType last) const
+    { return(prefix(last) - prefix(first)); }
+
+  // Used by detail::Decompose()
+  PrefixFunctor Prefix() const { return(PrefixFunctor(prefix_, mask())); }
+
+  detail::RangeSummary Summarize(SizeType lo, SizeType hi) const {
+    SizeType bl = lo / blockSize_, bh = hi / blockSize_;
+    if ( bl == bh )
+      return(scan(lo, hi));
+
+    detail::RangeSummary s = scan(lo, (bl + 1) * blockSize_ - 1);
+    if ( bl + 1 < bh ) {
+      SizeType s1 = (bl + 1) % blocks_, s2 = (bh - 1) % blocks_;
+      if ( s1 <= s2 )
+        s = detail::Combine(Prefix(), s, query(s1, s2 + 1));
+      else {
+        s = detail::Combine(Prefix(), s, query(s1, blocks_));
+        s = detail::Combine(Prefix(), s, query(0, s2 + 1));
+      }
+    }
+    return(detail::Combine(Prefix(), s, scan(bh * blockSize_, hi)));
+  }
+
+
+private:
+
+  SizeType mask() const { return(prefix_.size() - 1); }
+  ArithmeticType prefix(SizeType i) const { return(prefix_[i & mask()]); }
+
+  bool valid(SizeType j) const { return(j - front_ < stack_.size()); }
+  const CandidateType& at(SizeType j) const { return(stack_[j - front_]); }
+
+  Entry entry(const CandidateType& c) {
+    Entry e;
+    static_cast<CandidateType&>(e) = c;
+    e.serial_ = serial_++;
+    return(e);
+  }
+
+  // e leaves the results; note it if Changes() last reported it
+  void dropped(const Entry& e) {
+    if ( e.serial_ < mark_ )
+      removed_.push_back(RangeType(e.first_, e.last_));
+  }
+
+  /*
+    Steps 1 through 4 in paper for a new candidate c, as detail::Insert(),
+     on logical indices front_ .. front_ + stack_.size() - 1.  Nothing is
+     written out at step 2': older candidates stay maximal in the window.
+     A link may point outside the stack (to something dropped) or, after
+     replaceFront(), at a replacement whose L is larger than the link's
+     owner's; either way every candidate skipped by a link still has an L
+     no smaller than its owner's, which is all step 1 relies on.
+  */
+  void insert(CandidateType c) {
+    SizeType j = front_ + stack_.size() - 1;
+    while ( true ) {
+      while ( valid(j) && !(at(j).left_ < c.left_) ) // step 1
+        j = at(j).lower_;
+
+      if ( !valid(j) ) { // step 2'
+        c.lower_ = detail::NoCandidate();
+        stack_.push_back(entry(c));
+        return;
+      }
+
+      CandidateType cj = at(j);
+      if ( cj.right_ >= c.right_ ) { // step 3
+        c.lower_ = j;
+        stack_.push_back(entry(c));
+        return;
+      }
+
+      // step 4: extend c to the left to cover cj and reconsider
+      c.first_ = cj.first_;
+      c.left_ = cj.left_;
+      for ( SizeType i = j - front_; i < stack_.size(); ++i )
+        dropped(stack_[i]);
+      stack_.resize(j - front_);
+      j = cj.lower_;
+    } // while
+  }
+
+  /*
+    The front candidate [a, b) straddles the window start k: replace it by
+     the maximal scoring subsequences of [k, b).  They go at the logical
+     indices just below and including the old one's, so links to it land on
+     the last of them; each has an L larger than the old one's.
+  */
+  void replaceFront(SizeType k) {
+    std::vector<RangeType> pieces;
+    detail::Decompose(*this, k, stack_.front().last_,
+                      std::back_inserter(pieces));
+    const SizeType r = pieces.size();
+    if ( front_ + 1 < r )
+      renumber(r);
+    dropped(stack_.front());
+    stack_.pop_front();
+    ++front_;
+    if ( r == 0 )
+      return;
+
+    const SizeType first = front_ - r;
+    for ( SizeType i = r; i > 0; --i ) {
+      CandidateType c;
+      c.first_ = pieces[i - 1].first;
+      c.last_ = pieces[i - 1].second;
+      c.left_ = prefix(c.first_);
+      c.right_ = prefix(c.last_);
+      stack_.push_front(entry(c));
+    } // for
+    front_ = first;
+
+    // Links among the replacements: nearest older one with a smaller L
+    for ( SizeType i = 0; i < r; ++i ) {
+      SizeType j = (i > 0) ? front_ + i - 1 : detail::NoCandidate();
+      while ( valid(j) && j < front_ + i &&
+              !(at(j).left_ < stack_[i].left_) )
+        j = at(j).lower_;
+      stack_[i].lower_ = (valid(j) && j < front_ + i) ?
+                         j : detail::NoCandidate();
+    } // for
+  }
+
+  // Make room below front_ for n more logical indices
+  void renumber(SizeType n) {
+    const SizeType shift = n + stack_.size() + window_;
+    for ( SizeType i = 0; i < stack_.size(); ++i ) {
+      if ( valid(stack_[i].lower_) )
+        stack_[i].lower_ += shift;
+      else
+        stack_[i].lower_ = detail::NoCandidate();
+    } // for
+    front_ += shift;
+  }
+
+  // Subtract the total at the window start from every total held
+  void rebase() {
+    const ArithmeticType base = prefix(start_);
+    for ( SizeType i = start_; i <= position_; ++i )
+      prefix_[i & mask()] -= base;
+    for ( SizeType i = 0; i < stack_.size(); ++i ) {
+      stack_[i].left_ -= base;
+      stack_[i].right_ -= base;
+    } // for
+    rebased_ = start_;
+  }
+
+  detail::RangeSummary scan(SizeType lo, SizeType hi) const {
+    detail::RangeSummary s(lo);
+    for ( SizeType i = lo + 1; i <= hi; ++i )
+      s = detail::Combine(Prefix(), s, detail::RangeSummary(i));
+    return(s);
+  }
+
+  // Block b of prefix positions has just been completed
+  void summarize(SizeType b) {
+    SizeType node = blocks_ + b % blocks_;
+    tree_[node] = scan(b * blockSize_, (b + 1) * blockSize_ - 1);
+    for ( node /= 2; node > 0; node /= 2 )
+      tree_[node] = detail::Combine(Prefix(), tree_[2 * node],
+                                    tree_[2 * node + 1]);
+  }
+
+  // Summary of block slots [lo, hi), which must hold consecutive blocks
+  detail::RangeSummary query(SizeType lo, SizeType hi) const {
+    detail::RangeSummary left, right;
+    for ( lo += blocks_, hi += blocks_; lo < hi; lo /= 2, hi /= 2 ) {
+      if ( lo & 1 )
+        left = detail::Combine(Prefix(), left, tree_[lo++]);
+      if ( hi & 1 )
+        right = detail::Combine(Prefix(), tree_[--hi], right);
+    } // for
+    return(detail::Combine(Prefix(), left, right));
+  }
+
+
+private:
+  SizeType window_;
+  ArithmeticType threshold_;
+  SizeType position_, start_, rebased_;
+  SizeType blockSize_, blocks_;
+  std::vector<ArithmeticType> prefix_;      // ring of cumulative totals
+  std::vector<detail::RangeSummary> tree_;  // over a ring of blocks
+  std::deque<Entry> stack_;
+  SizeType front_;                          // logical index of stack_[0]
+  SizeType serial_, mark_;                  // next serial; at Changes()
+  std::vector<RangeType> removed_;          // since Changes()
+};
+
+} // namespace mss
+
+#endif // MSS_SLIDING_H
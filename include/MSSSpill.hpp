@@ -0,0 +1,246 @@
+/*
+
+FILE: MSSSpill.hpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+
+// Macro Guard
+#ifndef MSS_SPILL_H
+#define MSS_SPILL_H
+
+// Files included
+#include <cstddef>
+#include <cstdio>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "MSSStack.hpp"
+
+
+namespace mss {
+
+namespace detail {
+
+//============================================================================
+// SpillStack: a candidate store for Insert() that keeps at most a fixed
+//  number of candidates in memory.  When full, the oldest half of what is
+//  resident is appended to an anonymous temporary file (std::tmpfile()) as
+//  raw fixed-size records.  Step 1 reads spilled candidates back one block at
+//  a time when it walks that far; when step 4 erases everything resident,
+//  the most recent spilled candidates are paged back in.
+//
+//  Both buffers are allocated once, in the constructor, and never grow:
+//   the resident candidates (paged-in ones included) and one block read
+//   back from the file together fit in memoryBudget bytes, or in the
+//   minimum of MinResident + BlockRecords + 1 candidates for tiny budgets.
+//
+//  ArithmeticType must be safe to copy with fwrite()/fread(), as built-in
+//   arithmetic types are.
+//============================================================================
+template <typename ArithmeticType>
+class SpillStack {
+
+public:
+  typedef Candidate<ArithmeticType> Type;
+
+  enum { BlockRecords = 256, MinResident = 2 * BlockRecords };
+
+  explicit SpillStack(std::size_t memoryBudget)
+    : file_(0), base_(0), cacheFirst_(NoCandidate()), spills_(0) {
+    std::size_t records = memoryBudget / sizeof(Type);
+    maxResident_ = (records > MinResident + BlockRecords + 1)
+                     ? records - BlockRecords - 1
+                     : std::size_t(MinResident);
+    resident_.reserve(maxResident_ + 1); // Push() exceeds by one, then spills
+    cache_.reserve(BlockRecords);
+  }
+
+  ~SpillStack() {
+    if ( file_ )
+      std::fclose(file_);
+  }
+
+  std::size_t Size() const { return(base_ + resident_.size()); }
+
+  const Type& At(std::size_t i) const {
+    if ( i >= base_ )
+      return(resident_[i - base_]);
+    if ( cacheFirst_ == NoCandidate() || i < cacheFirst_ ||
+         i >= cacheFirst_ + cache_.size() ) {
+      cacheFirst_ = i - i % BlockRecords;
+      std::size_t cnt = base_ - cacheFirst_;
+      read(cacheFirst_, cnt < BlockRecords ? cnt : std::size_t(BlockRecords),
+           cache_);
+    }
+    return(cache_[i - cacheFirst_]);
+  }
+
+  void Push(const Type& c) {
+    resident_.push_back(c);
+    if ( resident_.size() > maxResident_ )
+      spill(resident_.size() / 2);
+  }
+
+  void Truncate(std::size_t sz) {
+    if ( sz >= base_ ) {
+      resident_.resize(sz - base_);
+      return;
+    }
+
+    // everything resident is gone: page in the newest spilled candidates
+    base_ = sz;
+    std::size_t cnt = (base_ < maxResident_ / 2) ? base_ : maxResident_ / 2;
+    base_ -= cnt;
+    read(base_, cnt, resident_);
+    cacheFirst_ = NoCandidate();
+  }
+
+  template <class OutputIterator>
+  void Drain(OutputIterator& out) {
+    for ( std::size_t i = 0; i < base_; i += BlockRecords ) {
+      std::size_t cnt = base_ - i;
+      read(i, cnt < BlockRecords ? cnt : std::size_t(BlockRecords), cache_);
+      for ( std::size_t j = 0; j < cache_.size(); ++j )
+        *out++ = std::make_pair(cache_[j].first_, cache_[j].last_);
+    } // for
+    for ( std::size_t j = 0; j < resident_.size(); ++j )
+      *out++ = std::make_pair(resident_[j].first_, resident_[j].last_);
+
+    base_ = 0;
+    resident_.clear();
+    cacheFirst_ = NoCandidate();
+  }
+
+  // Number of times candidates were written to the temporary file
+  std::size_t Spills() const { return(spills_); }
+
+  // Bytes of candidates held in memory; fixed at construction
+  std::size_t Memory() const {
+    return((resident_.capacity() + cache_.capacity()) * sizeof(Type));
+  }
+
+
+private:
+  SpillStack(const SpillStack&); // not copyable
+  SpillStack& operator=(const SpillStack&);
+
+  void seek(std::size_t record) const {
+    long offset = static_cast<long>(record * sizeof(Type));
+    if ( std::fseek(file_, offset, SEEK_SET) != 0 )
+      throw std::runtime_error("mss::SpillStack: seek failed");
+  }
+
+  void read(std::size_t first, std::size_t cnt, std::vector<Type>& v) const {
+    v.resize(cnt);
+    if ( cnt == 0 )
+      return;
+    seek(first);
+    if ( std::fread(&v[0], sizeof(Type), cnt, file_) != cnt )
+      throw std::runtime_error("mss::SpillStack: read failed");
+  }
+
+  void spill(std::size_t cnt) {
+    if ( !file_ && !(file_ = std::tmpfile()) )
+      throw std::runtime_error("mss::SpillStack: no temporary file");
+    seek(base_);
+    if ( std::fwrite(&resident_[0], sizeof(Type), cnt, file_) != cnt )
+      throw std::runtime_error("mss::SpillStack: write failed");
+    resident_.erase(resident_.begin(), resident_.begin() + cnt);
+    base_ += cnt;
+    cacheFirst_ = NoCandidate();
+    ++spills_;
+  }
+
+
+private:
+  std::FILE* file_;
+  std::size_t base_; // number of candidates in file_
+  std::size_t maxResident_;
+  std::vector<Type> resident_;
+  mutable std::size_t cacheFirst_;
+  mutable std::vector<Type> cache_;
+  std::size_t spills_;
+};
+
+} // namespace detail
+
+
+/*
+ ====================================
+ AlgMSS() with a memory budget :
+ ====================================
+  o Same results as AlgMSS(beg, end, out, threshold).
+  o For inputs whose cumulative total creeps upward (ie; long stretches of
+     weak signal), the unresolved candidate list can grow to millions of
+     entries.  Here, at most memoryBudget bytes of candidates are held in
+     memory, allocated up front (never less than a few hundred candidates,
+     see detail::SpillStack); older candidates are written to a temporary
+     file and read back only as the algorithm reaches them.  Each spilled
+     candidate takes 3*sizeof(size_t) + 2*sizeof(ArithmeticType) bytes on
+     disk.
+  o Candidates record positions rather than iterators, so ForwardIterator
+     pairs are rebuilt for out by walking one extra iterator over [beg, end)
+     once.
+  o Throws std::runtime_error if the temporary file cannot be created or
+     accessed.
+*/
+template <class ForwardIterator, class OutputIterator, class ArithmeticType>
+void AlgMSS(ForwardIterator beg, ForwardIterator end,
+            OutputIterator out, ArithmeticType threshold,
+            std::size_t memoryBudget) {
+
+  typedef detail::SpillStack<ArithmeticType> StackType;
+  typedef typename StackType::Type CandidateType;
+
+  StackType stack(memoryBudget);
+  detail::PositionOutput<ForwardIterator, OutputIterator> pout(beg, out);
+  ArithmeticType total = 0, resid = 0;
+  CandidateType c;
+
+  for ( std::size_t pos = 0; beg != end; ++beg, ++pos ) {
+    resid = *beg - threshold;
+    if ( resid > 0 ) {
+      c.first_ = pos;
+      c.last_ = pos + 1;
+      c.left_ = total;
+      total += resid;
+      c.right_ = total;
+      detail::Insert(stack, c, pout);
+    }
+    else
+      total += resid;
+  } // for
+  stack.Drain(pout);
+}
+
+} // namespace mss
+
+#endif // MSS_SPILL_H
@@ -0,0 +1,183 @@
+/*
+
+FILE: MSSStack.hpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+
+// Macro Guard
+#ifndef MSS_CANDIDATE_STACK_H
+#define MSS_CANDIDATE_STACK_H
+
+// Files included
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+
+/*
+  The building blocks here run the same steps as AlgMSS() but identify
+   elements by position (std::size_t) rather than by iterator, and keep the
+   unresolved candidates in a stack instead of a pair of std::list's.  They
+   are shared by the engines that do not hold on to a ForwardIterator range:
+   lockstep scans over many samples, streamed or spilled candidate lists, etc.
+
+  Output is the same as AlgMSS()'s, written as std::pair<std::size_t,
+   std::size_t> positions [first, last).
+*/
+
+namespace mss {
+
+namespace detail {
+
+inline std::size_t NoCandidate() { return(static_cast<std::size_t>(-1)); }
+
+//==========================================================================
+// Candidate: one unresolved subsequence [first_, last_) with its (L,R)
+//  cumulative totals from the paper.  lower_ is the position in the stack
+//  of the nearest older candidate with a smaller L (or NoCandidate()): any
+//  candidate in between has an L that is no smaller than left_, so step 1
+//  may jump directly to lower_ - this is what AlgMSS()'s searchList does.
+//==========================================================================
+template <typename ArithmeticType>
+struct Candidate {
+  std::size_t first_, last_, lower_;
+  ArithmeticType left_, right_;
+};
+
+//==========================================================================
+// CandidateStack: in-memory store for Insert().  Any store providing the
+//  same members may be used instead (see MSSSpill.hpp).
+//==========================================================================
+template <typename ArithmeticType>
+class CandidateStack {
+
+public:
+  typedef Candidate<ArithmeticType> Type;
+
+  std::size_t Size() const { return(stack_.size()); }
+  const Type& At(std::size_t i) const { return(stack_[i]); }
+  void Push(const Type& c) { stack_.push_back(c); }
+  void Truncate(std::size_t sz) { stack_.resize(sz); }
+
+  // Write all candidates, oldest first, and empty the stack
+  template <class OutputIterator>
+  void Drain(OutputIterator& out) {
+    typename std::vector<Type>::const_iterator i = stack_.begin();
+    while ( i != stack_.end() ) {
+      *out++ = std::make_pair(i->first_, i->last_);
+      ++i;
+    } // while
+    stack_.clear();
+  }
+
+private:
+  std::vector<Type> stack_;
+};
+
+/*
+ ==========
+ Insert() : steps 1 through 4 in paper for one new candidate
+ ==========
+  o c holds the new element's position and (L,R); lower_ is ignored.
+  o Every candidate that becomes final is written to out.
+*/
+template <class Store, class OutputIterator>
+void Insert(Store& st, typename Store::Type c, OutputIterator& out) {
+  std::size_t j = st.Size() ? st.Size() - 1 : NoCandidate();
+  while ( true ) {
+    while ( j != NoCandidate() && !(st.At(j).left_ < c.left_) ) // step 1
+      j = st.At(j).lower_;
+
+    if ( j == NoCandidate() ) { // step 2'
+      st.Drain(out);
+      c.lower_ = NoCandidate();
+      st.Push(c);
+      return;
+    }
+
+    typename Store::Type cj = st.At(j);
+    if ( cj.right_ >= c.right_ ) { // step 3
+      c.lower_ = j;
+      st.Push(c);
+      return;
+    }
+
+    // step 4: extend c to the left to cover cj and reconsider
+    c.first_ = cj.first_;
+    c.left_ = cj.left_;
+    st.Truncate(j);
+    j = cj.lower_;
+  } // while
+}
+
+//==========================================================================
+// PositionOutput: OutputIterator adaptor that turns the increasing
+//  std::pair<std::size_t, std::size_t> positions written by Insert() and
+//  Drain() back into ForwardIterator pairs, walking one cursor forward.
+//==========================================================================
+template <class ForwardIterator, class OutputIterator>
+class PositionOutput {
+
+public:
+  typedef std::output_iterator_tag iterator_category;
+  typedef void value_type;
+  typedef void difference_type;
+  typedef void pointer;
+  typedef void reference;
+
+  PositionOutput(ForwardIterator beg, OutputIterator out)
+    : cursor_(beg), position_(0), out_(out)
+    { /* */ }
+
+  PositionOutput& operator*() { return(*this); }
+  PositionOutput& operator++() { return(*this); }
+  PositionOutput& operator++(int) { return(*this); }
+
+  PositionOutput& operator=(const std::pair<std::size_t, std::size_t>& p) {
+    std::advance(cursor_, p.first - position_);
+    ForwardIterator first = cursor_;
+    std::advance(cursor_, p.second - p.first);
+    position_ = p.second;
+    *out_++ = std::make_pair(first, cursor_);
+    return(*this);
+  }
+
+
+private:
+  ForwardIterator cursor_;
+  std::size_t position_;
+  OutputIterator out_;
+};
+
+} // namespace detail
+
+} // namespace mss
+
+#endif // MSS_CANDIDATE_STACK_H
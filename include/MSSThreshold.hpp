@@ -0,0 +1,322 @@
+/*
+
+FILE: MSSThreshold.hpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+
+// Macro Guard
+#ifndef MSS_THRESHOLD_H
+#define MSS_THRESHOLD_H
+
+// Files included
+#include <cstddef>
+#include <iterator>
+#include <set>
+
+#include "MSS.hpp"
+#include "MSSStack.hpp"
+
+
+namespace mss {
+
+//===========================================================================
+// ThresholdRange: a threshold for every position, read from an
+//  InputIterator in step with the scores.  Made by MakeThresholds().
+//===========================================================================
+template <class InputIterator>
+struct ThresholdRange {
+  typedef typename std::iterator_traits<InputIterator>::value_type
+    ArithmeticType;
+
+  ThresholdRange(InputIterator i, ArithmeticType offset)
+    : iter_(i), offset_(offset)
+    { /* */ }
+
+  InputIterator iter_;
+  ArithmeticType offset_;
+};
+
+/*
+  Thresholds for AlgMSS(): the threshold at position i is the i'th value
+   read from 'thresholds' plus 'offset'.  Pass the begin iterator of a
+   background track (ie; a smoothed control), or a RollingMean<> or
+   RollingMedian<> of the scores themselves.
+*/
+template <class InputIterator>
+ThresholdRange<InputIterator>
+MakeThresholds(InputIterator thresholds,
+               typename ThresholdRange<InputIterator>::ArithmeticType
+                 offset = 0) {
+  return(ThresholdRange<InputIterator>(thresholds, offset));
+}
+
+
+namespace detail {
+
+//===========================================================================
+// RollingWindow: the bookkeeping shared by RollingMean<> and
+//  RollingMedian<>.  At position i the window covers positions
+//  [i - window/2, i - window/2 + window), clipped to the input.  Each
+//  input element is read twice: once entering the window and once leaving.
+//===========================================================================
+template <class Derived, class ForwardIterator, typename ArithmeticType>
+class RollingWindow {
+
+public:
+
+  // typedefs
+  typedef std::input_iterator_tag iterator_category;
+  typedef ArithmeticType value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef const ArithmeticType* pointer;
+  typedef ArithmeticType reference;
+
+  ArithmeticType operator*() const
+    { return(static_cast<const Derived*>(this)->value()); }
+
+  Derived& operator++() {
+    Derived& d = *static_cast<Derived*>(this);
+    if ( ahead_ != end_ )
+      d.add(*ahead_++);
+    if ( position_ >= window_ / 2 )
+      d.remove(*behind_++);
+    ++position_;
+    return(d);
+  }
+
+  Derived operator++(int) {
+    Derived d(*static_cast<Derived*>(this));
+    ++*this;
+    return(d);
+  }
+
+  bool operator==(const RollingWindow& r) const
+    { return(position_ == r.position_); }
+  bool operator!=(const RollingWindow& r) const
+    { return(position_ != r.position_); }
+
+  std::size_t Window() const { return(window_); }
+
+
+protected:
+  RollingWindow(ForwardIterator beg, ForwardIterator end, std::size_t window)
+    : ahead_(beg), behind_(beg), end_(end),
+      window_(window ? window : 1), position_(0)
+    { /* */ }
+
+  // Derived constructors call this once their own members are ready
+  void fill() {
+    Derived& d = *static_cast<Derived*>(this);
+    for ( std::size_t i = window_ / 2; i < window_ && ahead_ != end_; ++i )
+      d.add(*ahead_++);
+  }
+
+  ForwardIterator ahead_, behind_, end_;
+  std::size_t window_, position_;
+};
+
+} // namespace detail
+
+
+/*
+ ==============
+ RollingMean<> :
+ ==============
+  o InputIterator over the mean of [beg, end) in a window of 'window'
+     elements centered on each position (see detail::RollingWindow), for use
+     with MakeThresholds().  Constant time per position; the running sum is
+     recomputed from scratch once per window to keep rounding from
+     accumulating.
+*/
+template <class ForwardIterator, typename ArithmeticType = double>
+class RollingMean
+  : public detail::RollingWindow<RollingMean<ForwardIterator, ArithmeticType>,
+                                 ForwardIterator, ArithmeticType> {
+
+  typedef detail::RollingWindow<RollingMean, ForwardIterator, ArithmeticType>
+    BaseType;
+  friend class detail::RollingWindow<RollingMean, ForwardIterator,
+                                     ArithmeticType>;
+
+public:
+  RollingMean(ForwardIterator beg, ForwardIterator end, std::size_t window)
+    : BaseType(beg, end, window), sum_(0), count_(0), sinceExact_(0)
+    { this->fill(); }
+
+
+private:
+  ArithmeticType value() const
+    { return(count_ ? sum_ / ArithmeticType(count_) : ArithmeticType(0)); }
+
+  void add(ArithmeticType x) {
+    sum_ += x;
+    ++count_;
+  }
+
+  void remove(ArithmeticType x) {
+    --count_;
+    if ( ++sinceExact_ < this->window_ ) {
+      sum_ -= x;
+      return;
+    }
+    sinceExact_ = 0;
+    sum_ = 0;
+    for ( ForwardIterator i = this->behind_; i != this->ahead_; ++i )
+      sum_ += *i;
+  }
+
+
+private:
+  ArithmeticType sum_;
+  std::size_t count_, sinceExact_;
+};
+
+
+/*
+ ================
+ RollingMedian<> :
+ ================
+  o InputIterator over the median of [beg, end) in a window of 'window'
+     elements centered on each position (see detail::RollingWindow), for use
+     with MakeThresholds().  The mean of the two middle values is used when
+     the window holds an even number of elements.
+  o Logarithmic time per position in the window size, and memory
+     proportional to the window.
+*/
+template <class ForwardIterator, typename ArithmeticType = double>
+class RollingMedian
+  : public detail::RollingWindow<RollingMedian<ForwardIterator, ArithmeticType>,
+                                 ForwardIterator, ArithmeticType> {
+
+  typedef detail::RollingWindow<RollingMedian, ForwardIterator, ArithmeticType>
+    BaseType;
+  friend class detail::RollingWindow<RollingMedian, ForwardIterator,
+                                     ArithmeticType>;
+
+public:
+  RollingMedian(ForwardIterator beg, ForwardIterator end, std::size_t window)
+    : BaseType(beg, end, window)
+    { this->fill(); }
+
+
+private:
+  typedef std::multiset<ArithmeticType> LowType;  // lower half
+  typedef std::multiset<ArithmeticType> HighType; // upper half
+
+  ArithmeticType value() const {
+    if ( low_.empty() )
+      return(ArithmeticType(0));
+    if ( low_.size() > high_.size() )
+      return(*low_.rbegin());
+    return((*low_.rbegin() + *high_.begin()) / ArithmeticType(2));
+  }
+
+  void add(ArithmeticType x) {
+    if ( low_.empty() || !(*low_.rbegin() < x) )
+      low_.insert(x);
+    else
+      high_.insert(x);
+    balance();
+  }
+
+  void remove(ArithmeticType x) {
+    typename LowType::iterator i = low_.find(x);
+    if ( i != low_.end() )
+      low_.erase(i);
+    else
+      high_.erase(high_.find(x));
+    balance();
+  }
+
+  // low_ holds the lower half, and one more element when the count is odd
+  void balance() {
+    if ( low_.size() > high_.size() + 1 ) {
+      typename LowType::iterator i = --low_.end();
+      high_.insert(*i);
+      low_.erase(i);
+    }
+    else if ( high_.size() > low_.size() ) {
+      typename HighType::iterator i = high_.begin();
+      low_.insert(*i);
+      high_.erase(i);
+    }
+  }
+
+
+private:
+  LowType low_;
+  HighType high_;
+};
+
+
+/*
+ ========================================
+ AlgMSS() with per-position thresholds :
+ ========================================
+  o Same results as AlgMSS(beg, end, out, 0) on a copy of the scores with
+     each position's threshold subtracted, (*beg - (*t + offset)), but
+     without the copy: the thresholds are read in the same pass as the
+     scores, one per score.  Use MakeThresholds() to build 'thresholds'.
+  o Candidates record positions rather than iterators, so ForwardIterator
+     pairs are rebuilt for out by walking one extra iterator over [beg, end)
+     once.
+*/
+template <class ForwardIterator, class OutputIterator, class InputIterator>
+void AlgMSS(ForwardIterator beg, ForwardIterator end,
+            OutputIterator out, ThresholdRange<InputIterator> thresholds) {
+
+  typedef typename ThresholdRange<InputIterator>::ArithmeticType
+    ArithmeticType;
+  typedef detail::CandidateStack<ArithmeticType> StackType;
+  typedef typename StackType::Type CandidateType;
+
+  StackType stack;
+  detail::PositionOutput<ForwardIterator, OutputIterator> pout(beg, out);
+  ArithmeticType total = 0, resid = 0;
+  CandidateType c;
+
+  for ( std::size_t pos = 0; beg != end; ++beg, ++thresholds.iter_, ++pos ) {
+    resid = *beg - (*thresholds.iter_ + thresholds.offset_);
+    if ( resid > 0 ) {
+      c.first_ = pos;
+      c.last_ = pos + 1;
+      c.left_ = total;
+      total += resid;
+      c.right_ = total;
+      detail::Insert(stack, c, pout);
+    }
+    else
+      total += resid;
+  } // for
+  stack.Drain(pout);
+}
+
+} // namespace mss
+
+#endif // MSS_THRESHOLD_H
@@ -0,0 +1,258 @@
+/*
+
+FILE: MSSTransform.hpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+
+// Macro Guard
+#ifndef MSS_TRANSFORM_H
+#define MSS_TRANSFORM_H
+
+// Files included
+#include <cstddef>
+#include <iterator>
+
+#include "MSS.hpp"
+#include "MSSStack.hpp"
+
+
+namespace mss {
+
+namespace detail {
+
+  // Placeholder for an unused column of a TransformIterator
+  struct NoColumn {
+    NoColumn& operator++() { return(*this); }
+    NoColumn& operator--() { return(*this); }
+    NoColumn& operator+=(std::ptrdiff_t) { return(*this); }
+    NoColumn& operator-=(std::ptrdiff_t) { return(*this); }
+  };
+
+  // Result type of a function object (result_type) or function pointer
+  template <typename Function>
+  struct ResultOf {
+    typedef typename Function::result_type Type;
+  };
+
+  template <typename R, typename A>
+  struct ResultOf<R(*)(A)> {
+    typedef R Type;
+  };
+
+  template <typename R, typename A, typename B>
+  struct ResultOf<R(*)(A, B)> {
+    typedef R Type;
+  };
+
+  template <typename R, typename A, typename B, typename C>
+  struct ResultOf<R(*)(A, B, C)> {
+    typedef R Type;
+  };
+
+} // namespace detail
+
+
+/*
+ ===================
+ TransformIterator :
+ ===================
+  o Walks one, two or three columns of a structure-of-arrays layout in step
+     and yields f(a[i]), f(a[i], b[i]) or f(a[i], b[i], c[i]) on
+     dereference.  Nothing is stored: each score is computed from the raw
+     columns when AlgMSS() reads it, so no array of scores is ever made.
+  o Columns are random access iterators (pointers, std::vector<>
+     iterators, MappedArray<>::ConstIterator, ...) that move together;
+     comparisons and differences look only at the first column.
+  o Function is a function pointer or a function object with a const
+     operator() and a result_type typedef (ie; derived from
+     std::unary_function<> or std::binary_function<>).
+  o Results of AlgMSS() are pairs of TransformIterator's; subtract the
+     begin iterator for positions.
+  o Build with MakeTransform().
+*/
+template <class Function, class Iterator1,
+          class Iterator2 = detail::NoColumn,
+          class Iterator3 = detail::NoColumn>
+class TransformIterator {
+
+public:
+
+  // typedefs
+  typedef std::random_access_iterator_tag iterator_category;
+  typedef typename detail::ResultOf<Function>::Type value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef const value_type* pointer;
+  typedef value_type reference;
+
+  TransformIterator() { /* */ }
+
+  TransformIterator(Function f, Iterator1 i1,
+                    Iterator2 i2 = Iterator2(), Iterator3 i3 = Iterator3())
+    : f_(f), i1_(i1), i2_(i2), i3_(i3)
+    { /* */ }
+
+  reference operator*() const { return(apply(i2_, i3_, 0)); }
+  reference operator[](difference_type k) const { return(apply(i2_, i3_, k)); }
+
+  TransformIterator& operator++() { ++i1_; ++i2_; ++i3_; return(*this); }
+  TransformIterator& operator--() { --i1_; --i2_; --i3_; return(*this); }
+  TransformIterator operator++(int)
+    { TransformIterator t(*this); ++*this; return(t); }
+  TransformIterator operator--(int)
+    { TransformIterator t(*this); --*this; return(t); }
+
+  TransformIterator& operator+=(difference_type k)
+    { i1_ += k; i2_ += k; i3_ += k; return(*this); }
+  TransformIterator& operator-=(difference_type k)
+    { i1_ -= k; i2_ -= k; i3_ -= k; return(*this); }
+  TransformIterator operator+(difference_type k) const
+    { TransformIterator t(*this); return(t += k); }
+  TransformIterator operator-(difference_type k) const
+    { TransformIterator t(*this); return(t -= k); }
+  friend TransformIterator operator+(difference_type k,
+                                     const TransformIterator& t)
+    { return(t + k); }
+
+  difference_type operator-(const TransformIterator& t) const
+    { return(i1_ - t.i1_); }
+
+  bool operator==(const TransformIterator& t) const { return(i1_ == t.i1_); }
+  bool operator!=(const TransformIterator& t) const { return(i1_ != t.i1_); }
+  bool operator<(const TransformIterator& t) const { return(i1_ < t.i1_); }
+  bool operator>(const TransformIterator& t) const { return(t.i1_ < i1_); }
+  bool operator<=(const TransformIterator& t) const { return(!(t.i1_ < i1_)); }
+  bool operator>=(const TransformIterator& t) const { return(!(i1_ < t.i1_)); }
+
+  // The underlying columns, at this position
+  Iterator1 Column1() const { return(i1_); }
+  Iterator2 Column2() const { return(i2_); }
+  Iterator3 Column3() const { return(i3_); }
+
+
+private:
+
+  value_type apply(detail::NoColumn, detail::NoColumn,
+                   difference_type k) const
+    { return(f_(i1_[k])); }
+
+  template <class I>
+  value_type apply(I, detail::NoColumn, difference_type k) const
+    { return(f_(i1_[k], i2_[k])); }
+
+  template <class I, class J>
+  value_type apply(I, J, difference_type k) const
+    { return(f_(i1_[k], i2_[k], i3_[k])); }
+
+
+private:
+  Function f_;
+  Iterator1 i1_;
+  Iterator2 i2_;
+  Iterator3 i3_;
+};
+
+
+//==================================================================
+// MakeTransform(): TransformIterator over one, two or three columns
+//==================================================================
+template <class Function, class Iterator1>
+TransformIterator<Function, Iterator1>
+MakeTransform(Function f, Iterator1 i1) {
+  return(TransformIterator<Function, Iterator1>(f, i1));
+}
+
+template <class Function, class Iterator1, class Iterator2>
+TransformIterator<Function, Iterator1, Iterator2>
+MakeTransform(Function f, Iterator1 i1, Iterator2 i2) {
+  return(TransformIterator<Function, Iterator1, Iterator2>(f, i1, i2));
+}
+
+template <class Function, class Iterator1, class Iterator2, class Iterator3>
+TransformIterator<Function, Iterator1, Iterator2, Iterator3>
+MakeTransform(Function f, Iterator1 i1, Iterator2 i2, Iterator3 i3) {
+  return(TransformIterator<Function, Iterator1, Iterator2, Iterator3>(
+           f, i1, i2, i3));
+}
+
+
+/*
+ ==================================
+ AlgMSS() over TransformIterator's :
+ ==================================
+  o Same results as the general AlgMSS(), which the compiler picks instead
+     for any other iterator type.
+  o Scores are computed a block at a time in a loop that only reads the
+     columns and calls the function - a loop the compiler can vectorize when
+     the columns are contiguous and the function is simple enough to
+     inline.  Steps 1-4 then run over the block's positive scores only, on
+     a stack of candidates (see MSSStack.hpp) rather than std::list's.
+*/
+template <class Function, class Iterator1, class Iterator2, class Iterator3,
+          class OutputIterator, class ArithmeticType>
+void AlgMSS(TransformIterator<Function, Iterator1, Iterator2, Iterator3> beg,
+            TransformIterator<Function, Iterator1, Iterator2, Iterator3> end,
+            OutputIterator out, ArithmeticType threshold) {
+
+  typedef TransformIterator<Function, Iterator1, Iterator2, Iterator3> IType;
+  typedef detail::CandidateStack<ArithmeticType> StackType;
+  typedef typename StackType::Type CandidateType;
+  const std::size_t BlockSize = 1024;
+
+  detail::PositionOutput<IType, OutputIterator> pos(beg, out);
+  StackType stack;
+  CandidateType c;
+  ArithmeticType resid[BlockSize];
+  ArithmeticType total = 0;
+
+  const std::size_t sz = end - beg;
+  for ( std::size_t i = 0; i < sz; i += BlockSize ) {
+    const std::size_t n = (sz - i < BlockSize) ? sz - i : BlockSize;
+    const IType block = beg + i;
+    for ( std::size_t k = 0; k < n; ++k )
+      resid[k] = block[k] - threshold;
+
+    for ( std::size_t k = 0; k < n; ++k ) {
+      if ( resid[k] > 0 ) {
+        c.first_ = i + k;
+        c.last_ = i + k + 1;
+        c.left_ = total;
+        total += resid[k];
+        c.right_ = total;
+        detail::Insert(stack, c, pos);
+      }
+      else
+        total += resid[k];
+    } // for
+  } // for
+  stack.Drain(pos);
+}
+
+} // namespace mss
+
+#endif // MSS_TRANSFORM_H
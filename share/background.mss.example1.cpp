@@ -0,0 +1,161 @@
+/*
+
+FILE: background.mss.example1.cpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+#include "../include/MSS.hpp"
+#include "../include/MSSThreshold.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+
+//=======================================================================
+// main(): Pass in 0 to 2 arguments: a window size (default 1001) and an
+//         offset above the local background (default 1).
+//
+// Builds a track whose background drifts slowly, with short enriched
+//  stretches on top, and finds the stretches that rise above the local
+//  background in three ways: with a subtracted copy of the track, with
+//  a control track as the threshold, and with a rolling median of the
+//  track itself.  Checks the results against the subtracted copies.
+//=======================================================================
+int main(int argc, char** argv) {
+  using namespace std;
+  using namespace mss;
+
+  // Simple error check
+  if ( argc > 3 ) {
+    cerr << "Expect: " << argv[0] << " [<window> [<offset>]]" << endl;
+    return(-1);
+  }
+  size_t window = (argc > 1) ? strtoul(argv[1], 0, 10) : 1001;
+  double offset = (argc > 2) ? atof(argv[2]) : 1;
+
+  // Track: drifting background, noise and enriched stretches.  The
+  //  control is the background alone, as a smoothed input track would be.
+  const size_t SZ = 5000000;
+  unsigned int rnd = (unsigned)time(NULL);
+  cerr << "Random seed: " << rnd << endl;
+  srand(rnd);
+  vector<double> track(SZ), control(SZ);
+  for ( size_t i = 0; i < SZ; ++i ) {
+    control[i] = 5 + 4 * sin(i / 50000.0);
+    track[i] = control[i] + (rand() % 201 - 100) / 50.0;
+    if ( i % 20000 < 200 )
+      track[i] += 3;
+  } // for
+
+  typedef vector<double>::const_iterator IterType;
+  typedef pair<IterType, IterType> PairType;
+  size_t mismatches = 0;
+
+
+  // Control track as the threshold, without and with a subtracted copy
+  vector<PairType> fromControl, fromCopy;
+  clock_t start = clock();
+  AlgMSS(track.begin(), track.end(), back_inserter(fromControl),
+         MakeThresholds(control.begin(), offset));
+  double controlTime = double(clock() - start) / CLOCKS_PER_SEC;
+
+  vector<double> copy(SZ);
+  start = clock();
+  for ( size_t i = 0; i < SZ; ++i )
+    copy[i] = track[i] - (control[i] + offset);
+  AlgMSS(copy.begin(), copy.end(), back_inserter(fromCopy), 0.0);
+  double copyTime = double(clock() - start) / CLOCKS_PER_SEC;
+
+  mismatches += (fromControl.size() != fromCopy.size());
+  for ( size_t i = 0; !mismatches && i < fromCopy.size(); ++i ) {
+    mismatches += (fromControl[i].first - track.begin() !=
+                   fromCopy[i].first - copy.begin());
+    mismatches += (fromControl[i].second - track.begin() !=
+                   fromCopy[i].second - copy.begin());
+  } // for
+
+
+  // Rolling median of the track as the threshold, computed as it goes
+  typedef RollingMedian<IterType> MedianType;
+  vector<PairType> fromMedian, fromMedianCopy;
+  start = clock();
+  AlgMSS(track.begin(), track.end(), back_inserter(fromMedian),
+         MakeThresholds(MedianType(track.begin(), track.end(), window),
+                        offset));
+  double medianTime = double(clock() - start) / CLOCKS_PER_SEC;
+
+  MedianType median(track.begin(), track.end(), window);
+  for ( size_t i = 0; i < SZ; ++i, ++median )
+    copy[i] = track[i] - (*median + offset);
+  AlgMSS(copy.begin(), copy.end(), back_inserter(fromMedianCopy), 0.0);
+
+  mismatches += (fromMedian.size() != fromMedianCopy.size());
+  for ( size_t i = 0; !mismatches && i < fromMedianCopy.size(); ++i ) {
+    mismatches += (fromMedian[i].first - track.begin() !=
+                   fromMedianCopy[i].first - copy.begin());
+    mismatches += (fromMedian[i].second - track.begin() !=
+                   fromMedianCopy[i].second - copy.begin());
+  } // for
+
+
+  cout << "elements: " << SZ << "\twindow: " << window
+       << "\toffset: " << offset << endl;
+  cout << "control track seconds: " << controlTime
+       << "\tsubsequences: " << fromControl.size() << endl;
+  cout << "subtracted copy seconds: " << copyTime
+       << "\textra bytes: " << SZ * sizeof(double) << endl;
+  cout << "rolling median seconds: " << medianTime
+       << "\tsubsequences: " << fromMedian.size() << endl;
+  cout << "identical to subtracted copies: "
+       << (mismatches == 0 ? "yes" : "no") << endl;
+  return(mismatches == 0 ? 0 : -1);
+}
+
+
+/*
+  ------------
+  Discussion:
+  ------------
+  o The threshold at each position is read in step with the score, so any
+     InputIterator will do: a second track in memory or memory mapped with
+     MappedArray<> (MSSMappedFile.hpp), a RollingMean<> or RollingMedian<>,
+     or your own iterator computing a background as it goes.
+
+  o The rolling estimators read the track a little ahead of AlgMSS(), by
+     half a window, so their memory is bounded by the window rather than
+     the track.  A median costs a few std::multiset<> operations per
+     position; a mean costs a constant.
+
+  o A window that is too small will follow the enriched stretches
+     themselves and hide them.  Choose it well above the length of what you
+     are looking for.
+*/
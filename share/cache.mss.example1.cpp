@@ -0,0 +1,157 @@
+/*
+
+FILE: cache.mss.example1.cpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+#include "../include/MSS.hpp"
+#include "../include/MSSCache.hpp"
+#include "../include/MSSMappedFile.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+
+//===========================================================================
+// main(): Pass in 4 or 5 arguments: a cache directory, the most bytes of
+//         results to keep there, a file name, a threshold, and optionally
+//         a minimum length for reported subsequences.
+//         The file holds raw doubles, as written by fwrite().
+//
+// Writes "<start>\t<end>\t<score>" for each maximal scoring subsequence.
+//  Results come from the cache when this file's contents have been run
+//  before with the same threshold and minimum length, and are computed and
+//  stored otherwise.  Timings go to stderr.
+//===========================================================================
+int main(int argc, char** argv) {
+  using namespace std;
+  using namespace mss;
+
+  // Simple error check
+  if ( argc != 5 && argc != 6 ) {
+    cerr << "Expect: " << argv[0] << " <cache-dir> <max-bytes>"
+         << " <binary-input-file> <threshold> [<min-length>]" << endl;
+    return(-1);
+  }
+  size_t maxBytes = strtoul(argv[2], 0, 10);
+  double threshold = atof(argv[4]);
+  size_t minLength = (argc == 6) ? strtoul(argv[5], 0, 10) : 0;
+
+  try {
+    ResultCache cache(argv[1], maxBytes);
+    typedef MappedArray<double> TrackType;
+    TrackType track(argv[3]);
+
+
+    // Key: file contents, threshold and every option that changes results
+    clock_t start = clock();
+    ResultCache::DigestType digest =
+      cache.FileDigest(argv[3], track.Begin(), track.Size() * sizeof(double));
+    ostringstream os;
+    os << "min-length=" << minLength;
+    string options = os.str();
+    string key = cache.Key(digest, threshold, options);
+    cerr << "digest seconds: " << double(clock() - start) / CLOCKS_PER_SEC
+         << "\tkey: " << key << endl;
+
+
+    // Look up, or compute and store
+    vector<ResultCache::Segment> results;
+    start = clock();
+    if ( cache.Find(key, threshold, options, results) ) {
+      cerr << "hit: " << results.size() << " subsequences, seconds: "
+           << double(clock() - start) / CLOCKS_PER_SEC << endl;
+    }
+    else {
+      typedef pair<TrackType::ConstIterator, TrackType::ConstIterator> PairType;
+      vector<PairType> algOutput;
+      AlgMSS(track.Begin(), track.End(), back_inserter(algOutput), threshold);
+
+      for ( size_t i = 0; i < algOutput.size(); ++i ) {
+        if ( size_t(algOutput[i].second - algOutput[i].first) < minLength )
+          continue;
+        ResultCache::Segment s;
+        s.first_ = algOutput[i].first - track.Begin();
+        s.last_ = algOutput[i].second - track.Begin();
+        s.score_ = 0;
+        for ( TrackType::ConstIterator j = algOutput[i].first;
+                                       j != algOutput[i].second; ++j )
+          s.score_ += *j - threshold;
+        results.push_back(s);
+      } // for
+      cerr << "miss: " << results.size() << " subsequences, seconds: "
+           << double(clock() - start) / CLOCKS_PER_SEC << endl;
+      if ( !cache.Store(key, threshold, options, results) )
+        cerr << "Unable to store results in: " << argv[1] << endl;
+    }
+
+
+    // Report
+    for ( size_t i = 0; i < results.size(); ++i )
+      printf("%lu\t%lu\t%.10g\n", static_cast<unsigned long>(results[i].first_),
+             static_cast<unsigned long>(results[i].last_), results[i].score_);
+    cerr << "cache bytes: " << cache.Bytes() << " of " << maxBytes << endl;
+  } catch(exception& e) {
+    cerr << e.what() << endl;
+    return(-1);
+  }
+
+  return(0);
+}
+
+
+/*
+  ------------
+  Discussion:
+  ------------
+  o Running:
+     cache.mss.example1 /tmp/mss.cache 1000000000 chr1.bin 0.5 10
+    prints the maximal scoring subsequences of chr1.bin at threshold 0.5
+    that are at least 10 elements long, keeping up to 1GB of results in
+    /tmp/mss.cache.  Run it twice to see the difference.
+
+  o What a rerun costs:
+    The first time a file is seen, its digest takes one pass over it, in
+     blocks, which is cheaper than the AlgMSS() pass it may save.  While the
+     file's size, inode and modification time are unchanged, its digest is
+     remembered and a rerun only stats the file and reads back the stored
+     results.  A copy of the file elsewhere is hashed once and then hits
+     the same results.  Any change to the file means hashing all of it
+     again.
+
+  o Options:
+    Anything that changes the results must be part of the options string
+     given to Key(), Find() and Store(); here, the minimum length.  The
+     threshold is always part of the key.
+*/
@@ -0,0 +1,139 @@
+/*
+
+FILE: fasta.mss.example1.cpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+#include "../include/MSSFasta.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+
+//===========================================================================
+// main(): Pass in 3 or 4 arguments: 'dna' or 'protein', a FASTA file, the
+//         number of threads, and optionally a threshold (default 0).
+//
+//  dna     : G and C score +1, A and T score -1 and anything else 0, so
+//             results are GC-rich stretches.
+//  protein : Kyte-Doolittle hydropathy, so results are hydrophobic
+//             stretches such as candidate transmembrane segments.
+//
+// Writes "<record id>\t<start>\t<end>\t<score>" for each maximal scoring
+//  subsequence, with 0-based, half-open residue positions.
+//===========================================================================
+int main(int argc, char** argv) {
+  using namespace std;
+  using namespace mss;
+
+  // Simple error check
+  if ( argc != 4 && argc != 5 ) {
+    cerr << "Expect: " << argv[0]
+         << " <dna|protein> <fasta-file> <threads> [<threshold>]" << endl;
+    return(-1);
+  }
+  string alphabet = argv[1];
+  size_t threads = strtoul(argv[3], 0, 10);
+  double threshold = (argc == 5) ? atof(argv[4]) : 0;
+
+  ScoreTable<double> table;
+  if ( alphabet == "dna" ) {
+    table.Set("GC", 1);
+    table.Set("AT", -1);
+  }
+  else if ( alphabet == "protein" ) {
+    const char* residues = "ARNDCQEGHILKMFPSTWYV";
+    const double hydropathy[] = {  1.8, -4.5, -3.5, -3.5,  2.5,
+                                  -3.5, -3.5, -0.4, -3.2,  4.5,
+                                   3.8, -3.9,  1.9,  2.8, -1.6,
+                                  -0.8, -0.7, -0.9, -1.3,  4.2 };
+    for ( size_t i = 0; residues[i]; ++i )
+      table.Set(string(1, residues[i]), hydropathy[i]);
+  }
+  else {
+    cerr << "Expect 'dna' or 'protein', got: " << alphabet << endl;
+    return(-1);
+  }
+
+  try {
+    FastaFile fasta(argv[2]);
+    if ( fasta.Records() == 0 ) {
+      cerr << "No FASTA records found in: " << argv[2] << endl;
+      return(-1);
+    }
+
+    typedef FastaSegment<double> SegmentType;
+    vector<SegmentType> results;
+    AlgMSSFasta(fasta, table, back_inserter(results), threshold, threads);
+
+    string id;
+    size_t record = fasta.Records();
+    for ( size_t i = 0; i < results.size(); ++i ) {
+      if ( results[i].record_ != record ) {
+        record = results[i].record_;
+        id = fasta.Id(record);
+      }
+      printf("%s\t%lu\t%lu\t%.10g\n", id.c_str(),
+             static_cast<unsigned long>(results[i].first_),
+             static_cast<unsigned long>(results[i].last_),
+             results[i].score_);
+    } // for
+  } catch(exception& e) {
+    cerr << e.what() << endl;
+    return(-1);
+  }
+
+  return(0);
+}
+
+
+/*
+  ------------
+  Discussion:
+  ------------
+  o Running:
+     fasta.mss.example1 dna hg38.fa 8 0.2 > gc-rich.txt
+    maps hg38.fa, runs every record on up to 8 threads at threshold 0.2 and
+    writes the results in record order.
+
+  o No conversion step:
+    Residues are scored straight from the mapped file through a 256-entry
+     table, so there is no array of doubles (8 bytes per residue) alongside
+     the sequence.  Line breaks are skipped as they are met, and lower-case
+     (soft-masked) residues score like upper-case ones unless given their
+     own scores with ScoreTable<>::Set().
+
+  o Threads:
+    Records are the unit of work: a genome of many chromosomes or a file of
+     many proteins keeps every thread busy, while a single huge record runs
+     on one thread.  Link with -pthread.
+*/
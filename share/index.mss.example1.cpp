@@ -0,0 +1,116 @@
+/*
+
+FILE: index.mss.example1.cpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+#include "../include/MSSRangeIndex.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+
+//=========================================================================
+// main(): Pass in 3 arguments: a file name and a window [first, last).
+//         The file should be valid and should be full of + and - numbers.
+//
+// The index is built once; any number of window queries may follow.
+//=========================================================================
+int main(int argc, char** argv) {
+
+  // Simple error check
+  if ( argc != 4 ) {
+    std::cerr << "Expect: " << argv[0] << " <input-file> <first> <last>"
+              << std::endl;
+    return(-1);
+  }
+
+
+  // Open input file
+  std::ifstream inputFile(argv[1]); // your input file
+  if ( !inputFile ) {
+    std::cerr << "Unable to find: " << argv[1] << std::endl;
+    return(-1);
+  }
+
+
+  // Copy 'inputFile' into input container: 'inputScores'
+  typedef double T;
+  std::istream_iterator<T> inputIter(inputFile), eos;
+  std::vector<T> inputScores(inputIter, eos);
+  if ( inputScores.empty() ) {
+    std::cerr << "No data found in: " << argv[1] << std::endl;
+    return(-1);
+  }
+
+
+  // Build the index once for this track and threshold
+  T threshold = 0;
+  typedef mss::RangeIndex<T> IndexType;
+  IndexType index(inputScores.begin(), inputScores.end(), threshold);
+  std::cerr << "Index bytes: " << index.Memory() << std::endl;
+
+
+  // Query a window: cost depends on the number of results, not the window
+  IndexType::SizeType first = std::strtoul(argv[2], 0, 10);
+  IndexType::SizeType last = std::strtoul(argv[3], 0, 10);
+  std::vector<IndexType::RangeType> algOutput;
+  index.Query(first, last, std::back_inserter(algOutput));
+
+
+  // Send results to standard output: [start, end) and total score
+  std::vector<IndexType::RangeType>::const_iterator i = algOutput.begin();
+  while ( i != algOutput.end() ) {
+    std::cout << i->first << "\t" << i->second << "\t"
+              << index.Score(i->first, i->second) << std::endl;
+    ++i;
+  } // while
+
+  return(0);
+}
+
+
+/*
+  ------------
+  Discussion:
+  ------------
+  o Results are identical to copying elements [first, last) into their own
+     container and calling AlgMSS() on it, but here positions are reported
+     as offsets from the start of the track rather than as iterators.
+
+  o An index is tied to the threshold given at construction since every
+     cumulative total it stores has the threshold subtracted.  Build one
+     index per threshold of interest.
+
+  o The blockSize constructor argument trades memory for query speed: larger
+     blocks shrink the summary tree but make each query scan more elements.
+     See MSSRangeIndex.hpp for the exact memory bound.
+*/
@@ -0,0 +1,301 @@
+/*
+
+FILE: loadgen.mss.example1.cpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// POSIX
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+
+/*
+  Load generator for server.mss.example1.cpp: many client threads, each on
+   its own connection, send random window queries back to back.  Reports
+   queries per second and the latency distribution.
+*/
+
+
+//==========================================================================
+// Client: one connection to the server
+//==========================================================================
+class Client {
+
+public:
+  explicit Client(const std::string& socketPath) : fd_(-1), start_(0) {
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+    fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if ( fd_ >= 0 &&
+         ::connect(fd_, reinterpret_cast<sockaddr*>(&addr),
+                   sizeof(addr)) != 0 ) {
+      ::close(fd_);
+      fd_ = -1;
+    }
+  }
+
+  ~Client() {
+    if ( fd_ >= 0 )
+      ::close(fd_);
+  }
+
+  bool Ok() const { return(fd_ >= 0); }
+
+  // Send one request; collect the response lines up to the "." line
+  bool Ask(const std::string& request, std::vector<std::string>& response) {
+    response.clear();
+    std::string::size_type done = 0;
+    while ( done < request.size() ) {
+      ssize_t sent = ::send(fd_, request.data() + done, request.size() - done,
+                            MSG_NOSIGNAL);
+      if ( sent < 0 && errno == EINTR )
+        continue;
+      if ( sent <= 0 )
+        return(false);
+      done += sent;
+    } // while
+
+    while ( true ) {
+      std::string::size_type nl = in_.find('\n', start_);
+      if ( nl != std::string::npos ) {
+        std::string line(in_, start_, nl - start_);
+        start_ = nl + 1;
+        if ( line == "." )
+          return(true);
+        if ( line.compare(0, 4, "ERR ") == 0 ) {
+          response.push_back(line);
+          return(false);
+        }
+        response.push_back(line);
+        continue;
+      }
+      in_.erase(0, start_);
+      start_ = 0;
+
+      char buf[65536];
+      ssize_t got = ::recv(fd_, buf, sizeof(buf), 0);
+      if ( got < 0 && errno == EINTR )
+        continue;
+      if ( got <= 0 )
+        return(false);
+      in_.append(buf, got);
+    } // while
+  }
+
+private:
+  int fd_;
+  std::string in_;
+  std::string::size_type start_;
+};
+
+
+//==========================================================================
+// Run(): one client thread's share of the load
+//==========================================================================
+struct ClientArgs {
+  std::string socketPath_;
+  std::vector< std::pair<std::string, unsigned long> > tracks_;
+  unsigned long queries_, window_;
+  double threshold_;
+  unsigned int seed_;
+  std::vector<double> latencies_; // seconds
+  unsigned long results_, failures_;
+};
+
+double Now() {
+  timespec ts;
+  ::clock_gettime(CLOCK_MONOTONIC, &ts);
+  return(ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+extern "C" void* Run(void* p) {
+  ClientArgs* args = static_cast<ClientArgs*>(p);
+  args->results_ = args->failures_ = 0;
+  Client client(args->socketPath_);
+  if ( !client.Ok() ) {
+    args->failures_ = args->queries_;
+    return(0);
+  }
+
+  std::vector<std::string> response;
+  for ( unsigned long q = 0; q < args->queries_; ++q ) {
+    const std::pair<std::string, unsigned long>& t =
+      args->tracks_[rand_r(&args->seed_) % args->tracks_.size()];
+    unsigned long len = std::min(args->window_, t.second);
+    unsigned long first = 0;
+    if ( t.second > len )
+      first = rand_r(&args->seed_) % (t.second - len + 1);
+
+    std::ostringstream os;
+    os << t.first << " " << first << " " << first + len << " "
+       << args->threshold_ << "\n";
+
+    double start = Now();
+    bool ok = client.Ask(os.str(), response);
+    args->latencies_.push_back(Now() - start);
+    if ( ok )
+      args->results_ += response.size();
+    else if ( ++args->failures_ && response.empty() )
+      break; // connection lost
+  } // for
+  return(0);
+}
+
+
+//======
+// main
+//======
+int main(int argc, char** argv) {
+
+  // Simple error check
+  if ( argc < 4 || argc > 6 ) {
+    std::cerr << "Expect: " << argv[0]
+              << " <socket-path> <clients> <queries-per-client>"
+              << " [<window> [<threshold>]]" << std::endl;
+    return(-1);
+  }
+  std::string socketPath = argv[1];
+  int clients = std::atoi(argv[2]);
+  unsigned long queries = std::strtoul(argv[3], 0, 10);
+  unsigned long window = (argc > 4) ? std::strtoul(argv[4], 0, 10) : 300000;
+  double threshold = (argc > 5) ? std::atof(argv[5]) : 0;
+  if ( clients < 1 )
+    clients = 1;
+
+
+  // Ask the server what it holds
+  std::vector< std::pair<std::string, unsigned long> > tracks;
+  {
+    Client client(socketPath);
+    std::vector<std::string> response;
+    if ( !client.Ok() || !client.Ask("TRACKS\n", response) ) {
+      std::cerr << "Unable to query server at: " << socketPath << std::endl;
+      return(-1);
+    }
+    for ( std::size_t i = 0; i < response.size(); ++i ) {
+      std::istringstream is(response[i]);
+      std::pair<std::string, unsigned long> t;
+      if ( is >> t.first >> t.second && t.second > 0 )
+        tracks.push_back(t);
+    } // for
+    if ( tracks.empty() ) {
+      std::cerr << "Server holds no tracks" << std::endl;
+      return(-1);
+    }
+  }
+
+
+  // Fire
+  std::vector<ClientArgs> args(clients);
+  std::vector<pthread_t> threads(clients);
+  unsigned int seed = static_cast<unsigned int>(std::time(0));
+  std::cerr << "Random seed: " << seed << std::endl;
+  double start = Now();
+  for ( int i = 0; i < clients; ++i ) {
+    args[i].socketPath_ = socketPath;
+    args[i].tracks_ = tracks;
+    args[i].queries_ = queries;
+    args[i].window_ = window;
+    args[i].threshold_ = threshold;
+    args[i].seed_ = seed + i;
+    args[i].latencies_.reserve(queries);
+    if ( pthread_create(&threads[i], 0, Run, &args[i]) != 0 ) {
+      std::cerr << "Unable to start client threads" << std::endl;
+      return(-1);
+    }
+  } // for
+  for ( int i = 0; i < clients; ++i )
+    pthread_join(threads[i], 0);
+  double elapsed = Now() - start;
+
+
+  // Report
+  std::vector<double> all;
+  unsigned long results = 0, failures = 0;
+  for ( int i = 0; i < clients; ++i ) {
+    all.insert(all.end(), args[i].latencies_.begin(),
+               args[i].latencies_.end());
+    results += args[i].results_;
+    failures += args[i].failures_;
+  } // for
+  std::sort(all.begin(), all.end());
+  if ( all.empty() ) {
+    std::cerr << "No queries completed" << std::endl;
+    return(-1);
+  }
+
+  const double pct[] = { 0.5, 0.9, 0.99, 0.999 };
+  std::printf("clients: %d\tqueries: %lu\tfailures: %lu\tresults: %lu\n",
+              clients, static_cast<unsigned long>(all.size()), failures,
+              results);
+  std::printf("seconds: %.3f\tqueries/s: %.1f\n", elapsed,
+              all.size() / elapsed);
+  for ( std::size_t i = 0; i < sizeof(pct) / sizeof(double); ++i ) {
+    std::size_t at = static_cast<std::size_t>(pct[i] * (all.size() - 1));
+    std::printf("p%g latency ms: %.3f\n", pct[i] * 100, all[at] * 1e3);
+  } // for
+  std::printf("max latency ms: %.3f\n", all.back() * 1e3);
+  return(failures == 0 ? 0 : -1);
+}
+
+
+/*
+  ------------
+  Discussion:
+  ------------
+  o Running:
+     loadgen.mss.example1 /tmp/mss.sock 16 1000 300000 0
+    opens 16 connections to the server on /tmp/mss.sock and sends 1000
+    queries on each, every one a random window of 300000 elements from a
+    random track at threshold 0.
+
+  o Latency is measured per query, from sending the request to reading the
+     final "." line, so it includes transfer of all results.  Queries per
+     second are over the whole run, all clients together.
+
+  o Use at least as many clients as the server has threads to keep every
+     worker busy.  With more clients than threads, requests wait for a free
+     worker, which shows up as a longer tail.
+*/
@@ -0,0 +1,129 @@
+/*
+
+FILE: lockstep.mss.example1.cpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+#include "../include/MSS.hpp"
+#include "../include/MSSLockstep.hpp"
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+//=====================================================================
+// main(): generate random scores for many samples over the same
+//         positions, run all samples in lockstep, and check the results
+//         against one AlgMSS() call per sample.
+//=====================================================================
+int main() {
+  using namespace std;
+  using namespace mss;
+
+  const size_t SAMPLES = 512, POSITIONS = 20000;
+
+  // Position-major matrix: scores[p*SAMPLES + s]
+  unsigned int rnd = (unsigned)time(NULL);
+  cerr << "Random seed: " << rnd << endl;
+  srand(rnd);
+  vector<double> scores(SAMPLES * POSITIONS);
+  for ( size_t i = 0; i < scores.size(); ++i )
+    scores[i] = (rand() % 2001 - 1000) / 100.0;
+
+  // One output container per sample, and one OutputIterator into each
+  typedef pair<size_t, size_t> PairType;
+  typedef vector<PairType> OutputType;
+  vector<OutputType> lockOutput(SAMPLES);
+  vector< back_insert_iterator<OutputType> > outs;
+  for ( size_t s = 0; s < SAMPLES; ++s )
+    outs.push_back(back_inserter(lockOutput[s]));
+
+  // All samples in one pass over the matrix
+  clock_t start = clock();
+  AlgMSSLockstep(scores.begin(), SAMPLES, POSITIONS, outs, 0.0);
+  double lockTime = double(clock() - start) / CLOCKS_PER_SEC;
+
+  // The same thing, one sample at a time
+  clock_t singleTicks = 0;
+  size_t mismatches = 0;
+  vector<double> row(POSITIONS);
+  for ( size_t s = 0; s < SAMPLES; ++s ) {
+    for ( size_t p = 0; p < POSITIONS; ++p )
+      row[p] = scores[p * SAMPLES + s];
+
+    typedef vector<double>::iterator IterType;
+    vector< pair<IterType, IterType> > algOutput;
+    start = clock();
+    AlgMSS(row.begin(), row.end(), back_inserter(algOutput), 0.0);
+    singleTicks += clock() - start;
+
+    if ( algOutput.size() != lockOutput[s].size() ) {
+      ++mismatches;
+      continue;
+    }
+    for ( size_t i = 0; i < algOutput.size(); ++i ) {
+      PairType p(algOutput[i].first - row.begin(),
+                 algOutput[i].second - row.begin());
+      if ( p != lockOutput[s][i] ) {
+        ++mismatches;
+        break;
+      }
+    } // for
+  } // for
+  double singleTime = double(singleTicks) / CLOCKS_PER_SEC;
+
+  cout << "samples: " << SAMPLES << "\tpositions: " << POSITIONS << endl;
+  cout << "lockstep seconds: " << lockTime << endl;
+  cout << "per-sample AlgMSS() seconds: " << singleTime << endl;
+  cout << "samples with differing results: " << mismatches << endl;
+  return(mismatches == 0 ? 0 : -1);
+}
+
+
+/*
+  ------------
+  Discussion:
+  ------------
+  o Input layout:
+    AlgMSSLockstep() wants all samples' scores at a position to be adjacent.
+     If your matrix is stored sample-major instead (one complete track after
+     another), feed mss::Lockstep<>::Push() a column at a time that you
+     gather yourself, or transpose once up front.
+
+  o Streaming:
+    mss::Lockstep<> may be used directly when positions arrive in pieces,
+     such as rows of a file: call Push() once per position, in order, and
+     Finish() once at the end.  Finished subsequences are written as soon as
+     they are known, so outputs fill in as the scan progresses.
+
+  o Per-sample thresholds:
+    Construct mss::Lockstep<> with a range of thresholds, one per sample, if
+     samples should not share a threshold.
+*/
@@ -0,0 +1,232 @@
+/*
+
+FILE: pyramid.mss.example1.cpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+#include "../include/MSS.hpp"
+#include "../include/MSSCache.hpp"
+#include "../include/MSSMappedFile.hpp"
+#include "../include/MSSPyramid.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+//===========================================================================
+// main(): Pass in 2 or 3 arguments: a file name, the coarsest level to scan
+//         (a bin is 2^level elements) and optionally the padding, in bins.
+//         The file holds raw doubles, as written by fwrite().
+//
+// The pyramid is stored alongside the track as <file>.pyr and reused on
+//  later runs, as long as it was built from the same track contents.
+//  Benchmarks a coarse-to-fine scan against a full-resolution AlgMSS() run
+//  and reports how the results relate.
+//===========================================================================
+int main(int argc, char** argv) {
+  using namespace std;
+  using namespace mss;
+
+  // Simple error check
+  if ( argc != 3 && argc != 4 ) {
+    cerr << "Expect: " << argv[0] << " <binary-input-file> <level> [pad]"
+         << endl;
+    return(-1);
+  }
+  size_t level = strtoul(argv[2], 0, 10);
+  size_t pad = (argc == 4) ? strtoul(argv[3], 0, 10) : 1;
+  double threshold = 0;
+
+  try {
+    typedef MappedArray<double> TrackType;
+    TrackType track(argv[1]);
+    if ( track.Size() == 0 ) {
+      cerr << "No data found in: " << argv[1] << endl;
+      return(-1);
+    }
+
+
+    // Load the pyramid stored alongside the track, or build and store it.
+    //  The track's digest takes one fast pass and tells a rewritten track
+    //  from the one the pyramid was built from, whatever its size or times.
+    uint64_t source = detail::HashBytes(
+                        reinterpret_cast<const unsigned char*>(track.Begin()),
+                        track.Size() * sizeof(double), 0);
+    string pyrName = string(argv[1]) + ".pyr";
+    ifstream pyrIn(pyrName.c_str(), ios::binary);
+    Pyramid<double>* pyr = 0;
+    if ( pyrIn ) {
+      try {
+        pyr = new Pyramid<double>(pyrIn, source);
+      } catch(exception& e) {
+        cerr << pyrName << ": " << e.what() << "; rebuilding" << endl;
+      }
+    }
+    if ( !pyr || pyr->Levels() < level ) {
+      delete pyr;
+      clock_t start = clock();
+      pyr = new Pyramid<double>(track.Begin(), track.End(), level, source);
+      cout << "pyramid build seconds: "
+           << double(clock() - start) / CLOCKS_PER_SEC << endl;
+      ofstream pyrOut(pyrName.c_str(), ios::binary);
+      pyr->Write(pyrOut);
+    }
+
+
+    // Full resolution
+    typedef pair<size_t, size_t> RangeType;
+    typedef pair<TrackType::ConstIterator, TrackType::ConstIterator> PairType;
+    vector<PairType> algOutput;
+    clock_t start = clock();
+    AlgMSS(track.Begin(), track.End(), back_inserter(algOutput), threshold);
+    double fullTime = double(clock() - start) / CLOCKS_PER_SEC;
+
+    vector<RangeType> full;
+    for ( size_t i = 0; i < algOutput.size(); ++i )
+      full.push_back(RangeType(algOutput[i].first - track.Begin(),
+                               algOutput[i].second - track.Begin()));
+
+
+    // Coarse to fine, refining every coarse result
+    vector<RangeType> refined;
+    start = clock();
+    pyr->Scan(track.Begin(), level, threshold, back_inserter(refined), pad);
+    double scanTime = double(clock() - start) / CLOCKS_PER_SEC;
+
+
+    // Coarse to fine, refining only coarse results scoring above a cutoff.
+    //  A heuristic with no guarantee (see below); the cutoff here is simply
+    //  the same value as the bound.
+    double m = *max_element(track.Begin(), track.End()) - threshold;
+    double bound = 2.0 * ((size_t(1) << level) - 1) * m;
+    vector<RangeType> coarse, promising, strongRefined;
+    start = clock();
+    pyr->Segments(level, threshold, 0, track.Size(), back_inserter(coarse));
+    const vector<double>& bins = pyr->Level(level);
+    for ( size_t i = 0; i < coarse.size(); ++i ) {
+      double score = accumulate(bins.begin() + (coarse[i].first >> level),
+                                bins.begin() + ((coarse[i].second - 1) >> level)
+                                             + 1, 0.0)
+                     - threshold * (coarse[i].second - coarse[i].first);
+      if ( score > bound )
+        promising.push_back(coarse[i]);
+    } // for
+    pyr->Refine(track.Begin(), level, threshold,
+                promising.begin(), promising.end(),
+                back_inserter(strongRefined), pad);
+    double promisingTime = double(clock() - start) / CLOCKS_PER_SEC;
+
+
+    // How do they relate?  See the Guarantee section in MSSPyramid.hpp
+    size_t strong = 0, strongFound = 0, strongFoundPromising = 0;
+    for ( size_t i = 0; i < full.size(); ++i ) {
+      double score = accumulate(track.Begin() + full[i].first,
+                                track.Begin() + full[i].second, 0.0)
+                     - threshold * (full[i].second - full[i].first);
+      if ( score > bound ) {
+        ++strong;
+        strongFound += binary_search(refined.begin(), refined.end(), full[i]);
+        strongFoundPromising += binary_search(strongRefined.begin(),
+                                              strongRefined.end(), full[i]);
+      }
+    } // for
+    vector<RangeType> same;
+    set_intersection(full.begin(), full.end(), refined.begin(), refined.end(),
+                     back_inserter(same));
+
+    cout << "elements: " << track.Size() << "\tlevel: " << level
+         << " (bins of " << (size_t(1) << level) << ")\tpad: " << pad << endl;
+    cout << "full resolution seconds: " << fullTime
+         << "\tsubsequences: " << full.size() << endl;
+    cout << "coarse-to-fine seconds: " << scanTime
+         << "\tsubsequences: " << refined.size()
+         << "\tidentical to full resolution: " << same.size() << endl;
+    cout << "coarse-to-fine, promising only (heuristic), seconds: "
+         << promisingTime
+         << "\tsubsequences: " << strongRefined.size() << endl;
+    cout << "full resolution results scoring above " << bound
+         << ": " << strong << endl;
+    cout << "  found identically by coarse-to-fine: " << strongFound
+         << ", by promising only: " << strongFoundPromising
+         << " (no guarantee)" << endl;
+
+    delete pyr;
+  } catch(exception& e) {
+    cerr << e.what() << endl;
+    return(-1);
+  }
+
+  return(0);
+}
+
+
+/*
+  ------------
+  Discussion:
+  ------------
+  o Choosing a level:
+    Each level halves the work of the one below it, so a scan starting at
+     level 10 (bins of 1024 elements) touches roughly 1/1000th of the track
+     at its coarsest step.  Finer levels and the final AlgMSS() only visit
+     the windows around what was found, so total time depends mostly on how
+     much of the track ends up inside windows.
+
+  o Refining everything or only what is promising:
+    Maximal scoring subsequences tend to cover a good part of a track, and
+     so do the windows around coarse results.  Refining all of them costs
+     about as much as a full-resolution pass over the covered part.  Handing
+     Refine() only the coarse results scoring above some cutoff is where
+     most of the savings come from, but it is a heuristic.  The guarantee
+     says a strong subsequence overlaps some coarse result, not that this
+     coarse result scores well: a strong subsequence can sit in a weak or
+     split coarse result and be missed.  The last line printed shows how
+     many were missed with the cutoff used here (the bound's value, chosen
+     for convenience only).
+
+  o What is found:
+    When every coarse result is refined, any full-resolution subsequence
+     scoring more than the printed bound overlaps a coarse result and so is
+     looked at again at the next finer level.  Weaker subsequences,
+     especially short ones isolated in negative surroundings, can be lost in
+     their bins' sums.  Results near a window edge may be clipped; a larger
+     pad trades speed for fewer of those.
+
+  o The pyramid file:
+    <file>.pyr uses the machine's native layout for sizes and doubles, like
+     the track itself.  It records a digest of the track it was built from
+     and is rebuilt when the track's contents change or when a deeper level
+     is requested.
+*/
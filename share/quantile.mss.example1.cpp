@@ -0,0 +1,121 @@
+/*
+
+FILE: quantile.mss.example1.cpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+#include "../include/MSS.hpp"
+#include "../include/MSSMappedFile.hpp"
+#include "../include/MSSQuantile.hpp"
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+
+//=========================================================================
+// main(): Pass in 2 arguments: a file name and a quantile in [0,1].
+//         The file holds raw doubles, as written by fwrite().  It is
+//         memory mapped and never copied: the quantile of its values is
+//         used as the threshold for AlgMSS() run directly on the mapping.
+//=========================================================================
+int main(int argc, char** argv) {
+
+  // Simple error check
+  if ( argc != 3 ) {
+    std::cerr << "Expect: " << argv[0] << " <binary-input-file> <quantile>"
+              << std::endl;
+    return(-1);
+  }
+
+  try {
+    typedef mss::MappedArray<double> TrackType;
+    TrackType track(argv[1]);
+    if ( track.Size() == 0 ) {
+      std::cerr << "No data found in: " << argv[1] << std::endl;
+      return(-1);
+    }
+    double q = std::atof(argv[2]);
+
+
+    // One pass: estimate, with a guaranteed bound on the rank error
+    mss::QuantileSketch<double> sketch;
+    sketch.Add(track.Begin(), track.End());
+    std::cerr << "Estimated quantile: " << sketch.Quantile(q)
+              << " (rank error <= "
+              << sketch.RankError() + sketch.MaxWeight()
+              << " of " << sketch.Count() << ")" << std::endl;
+
+
+    // Two passes: exact
+    double threshold = mss::ExactQuantile(track.Begin(), track.End(), q);
+    std::cerr << "Threshold: " << threshold << std::endl;
+
+
+    // Run AlgMSS() on the mapped data
+    typedef std::pair<TrackType::ConstIterator,
+                      TrackType::ConstIterator> PairType;
+    std::vector<PairType> algOutput;
+    mss::AlgMSS(track.Begin(), track.End(),
+                std::back_inserter(algOutput),
+                threshold);
+
+
+    // Send results to standard output: [start, end) and sum of scores
+    std::vector<PairType>::const_iterator i = algOutput.begin();
+    while ( i != algOutput.end() ) {
+      std::cout << i->first - track.Begin() << "\t"
+                << i->second - track.Begin() << "\t"
+                << std::accumulate(i->first, i->second, 0.0) << std::endl;
+      ++i;
+    } // while
+  } catch(std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return(-1);
+  }
+
+  return(0);
+}
+
+
+/*
+  ------------
+  Discussion:
+  ------------
+  o The sketch alone is often good enough for a threshold, and it can be fed
+     while data are being read or received, before AlgMSS() needs them.  Its
+     memory use depends on the k constructor argument (default 4096) and
+     grows only with the logarithm of the number of values.
+
+  o mss::ExactQuantile() needs to see the data twice, so it wants a
+     ForwardIterator range.  The mapped file provides one without holding
+     the data in process memory.
+*/
@@ -0,0 +1,192 @@
+/*
+
+FILE: segindex.mss.example1.cpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+#include "../include/MSS.hpp"
+#include "../include/MSSMappedFile.hpp"
+#include "../include/MSSSegmentIndex.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+
+//===========================================================================
+// main(): Pass in 3 arguments: a file name, a threshold and the name of the
+//         segment index to write.  The file holds raw doubles, as written
+//         by fwrite().
+//
+// Runs AlgMSS() over the track and stores the results as a segment index.
+//  Then opens the index and times point, batched and interval lookups,
+//  checking each answer against a search of the results in memory.
+//===========================================================================
+int main(int argc, char** argv) {
+  using namespace std;
+  using namespace mss;
+
+  // Simple error check
+  if ( argc != 4 ) {
+    cerr << "Expect: " << argv[0]
+         << " <binary-input-file> <threshold> <index-file>" << endl;
+    return(-1);
+  }
+  double threshold = atof(argv[2]);
+
+  try {
+    typedef MappedArray<double> TrackType;
+    TrackType track(argv[1]);
+    if ( track.Size() == 0 ) {
+      cerr << "No data found in: " << argv[1] << endl;
+      return(-1);
+    }
+
+
+    // Write the index
+    typedef pair<TrackType::ConstIterator, TrackType::ConstIterator> PairType;
+    vector<PairType> algOutput;
+    AlgMSS(track.Begin(), track.End(), back_inserter(algOutput), threshold);
+
+    clock_t start = clock();
+    vector<uint64_t> lasts; // for checking below
+    {
+      SegmentIndexWriter writer(argv[3]);
+      for ( size_t i = 0; i < algOutput.size(); ++i ) {
+        double score = 0;
+        for ( TrackType::ConstIterator j = algOutput[i].first;
+                                       j != algOutput[i].second; ++j )
+          score += *j - threshold;
+        writer.Add(algOutput[i].first - track.Begin(),
+                   algOutput[i].second - track.Begin(), score);
+        lasts.push_back(algOutput[i].second - track.Begin());
+      } // for
+      writer.Close();
+    }
+    double writeTime = double(clock() - start) / CLOCKS_PER_SEC;
+
+
+    // Open it, as a lookup service would at startup
+    start = clock();
+    SegmentIndex index(argv[3]);
+    double openTime = double(clock() - start) / CLOCKS_PER_SEC;
+
+
+    // Random points, one at a time
+    const size_t QUERIES = 1000000;
+    unsigned int rnd = (unsigned)time(NULL);
+    cerr << "Random seed: " << rnd << endl;
+    srand(rnd);
+    vector<uint64_t> points(QUERIES);
+    for ( size_t i = 0; i < QUERIES; ++i )
+      points[i] = (uint64_t(rand()) * RAND_MAX + rand()) % track.Size();
+
+    vector<size_t> found(QUERIES);
+    start = clock();
+    for ( size_t i = 0; i < QUERIES; ++i )
+      found[i] = index.Find(points[i]);
+    double pointTime = double(clock() - start) / CLOCKS_PER_SEC;
+
+    size_t mismatches = 0, hits = 0;
+    for ( size_t i = 0; i < QUERIES; ++i ) {
+      size_t r = upper_bound(lasts.begin(), lasts.end(), points[i]) -
+                 lasts.begin();
+      if ( r != lasts.size() &&
+           uint64_t(algOutput[r].first - track.Begin()) > points[i] )
+        r = index.Size();
+      mismatches += (r != found[i]);
+      hits += (r != index.Size());
+    } // for
+
+
+    // The same points as one sorted batch
+    vector<uint64_t> sorted(points);
+    sort(sorted.begin(), sorted.end());
+    vector<size_t> batch;
+    batch.reserve(QUERIES);
+    start = clock();
+    index.Find(sorted.begin(), sorted.end(), back_inserter(batch));
+    double batchTime = double(clock() - start) / CLOCKS_PER_SEC;
+    for ( size_t i = 0; i < QUERIES; ++i )
+      mismatches += (batch[i] != index.Find(sorted[i]));
+
+
+    // Intervals of up to 1000 positions
+    size_t overlaps = 0;
+    vector<size_t> over;
+    start = clock();
+    for ( size_t i = 0; i < QUERIES; ++i ) {
+      over.clear();
+      index.Overlaps(points[i], points[i] + 1 + points[i] % 1000,
+                     back_inserter(over));
+      overlaps += over.size();
+    } // for
+    double intervalTime = double(clock() - start) / CLOCKS_PER_SEC;
+
+
+    cout << "segments: " << index.Size() << "\twrite seconds: " << writeTime
+         << "\topen seconds: " << openTime << endl;
+    cout << "point lookups: " << QUERIES << "\thits: " << hits
+         << "\tmicroseconds each: " << pointTime * 1e6 / QUERIES << endl;
+    cout << "sorted batch, microseconds each: "
+         << batchTime * 1e6 / QUERIES << endl;
+    cout << "interval lookups: " << QUERIES << "\toverlaps: " << overlaps
+         << "\tmicroseconds each: " << intervalTime * 1e6 / QUERIES << endl;
+    cout << "answers differing from an in-memory search: " << mismatches
+         << endl;
+    return(mismatches == 0 ? 0 : -1);
+  } catch(exception& e) {
+    cerr << e.what() << endl;
+    return(-1);
+  }
+}
+
+
+/*
+  ------------
+  Discussion:
+  ------------
+  o Serving lookups:
+    A service opens each index with mss::SegmentIndex and answers from the
+     mapping: nothing is parsed or copied at startup, and pages are read
+     from disk only as lookups touch them.  Several processes opening the
+     same index share one copy in the page cache.
+
+  o One index per track:
+    An index holds the results of one track (ie; one chromosome).  Keep one
+     file per track and pick the file by name.
+
+  o Batches:
+    When many positions are asked about at once, sort them and use the
+     batched Find(): each answer starts from the previous one, so nearby
+     positions cost a few comparisons instead of a full search.
+*/
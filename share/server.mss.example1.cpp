@@ -0,0 +1,503 @@
+/*
+
+FILE: server.mss.example1.cpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+#include "../include/MSS.hpp"
+#include "../include/MSSMappedFile.hpp"
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// POSIX
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+/*
+  A long-running server that loads tracks once and answers AlgMSS() queries
+   over a Unix domain socket.  The request protocol is described after
+   main(); see loadgen.mss.example1.cpp for a client.
+*/
+
+
+//==========================================================================
+// Track: scores that stay resident for the life of the server.  Files of
+//  raw doubles are memory mapped; files ending in .txt are parsed once.
+//  Either way, queries share the same read-only data.
+//==========================================================================
+struct Track {
+  explicit Track(const std::string& path) : map_(0), begin_(0), size_(0) {
+    std::string::size_type sz = path.size();
+    if ( sz > 4 && path.compare(sz - 4, 4, ".txt") == 0 ) {
+      std::ifstream inputFile(path.c_str());
+      if ( !inputFile )
+        throw std::runtime_error("Unable to find: " + path);
+      std::istream_iterator<double> inputIter(inputFile), eos;
+      text_.assign(inputIter, eos);
+      begin_ = text_.empty() ? 0 : &text_[0];
+      size_ = text_.size();
+    }
+    else {
+      map_ = new mss::MappedArray<double>(path);
+      begin_ = map_->Begin();
+      size_ = map_->Size();
+    }
+  }
+
+  ~Track() { delete map_; }
+
+  mss::MappedArray<double>* map_;
+  std::vector<double> text_;
+  const double* begin_;
+  std::size_t size_;
+
+private:
+  Track(const Track&); // not copyable
+  Track& operator=(const Track&);
+};
+
+typedef std::map<std::string, Track*> TrackMap;
+
+
+//==========================================================================
+// Connection: line-oriented reads and buffered writes on a socket
+//==========================================================================
+class Connection {
+
+public:
+  explicit Connection(int fd) : fd_(fd), start_(0) { /* */ }
+  ~Connection() { ::close(fd_); }
+
+  int Fd() const { return(fd_); }
+
+  // Read what has arrived; false at end of input or on error
+  bool Receive() {
+    char buf[65536];
+    ssize_t got;
+    do {
+      got = ::recv(fd_, buf, sizeof(buf), 0);
+    } while ( got < 0 && errno == EINTR );
+    if ( got <= 0 )
+      return(false);
+    in_.erase(0, start_);
+    start_ = 0;
+    in_.append(buf, got);
+    return(true);
+  }
+
+  // Next complete line received, if any
+  bool NextLine(std::string& line) {
+    std::string::size_type nl = in_.find('\n', start_);
+    if ( nl == std::string::npos )
+      return(false);
+    line.assign(in_, start_, nl - start_);
+    start_ = nl + 1;
+    return(true);
+  }
+
+  void Write(const std::string& s) {
+    out_ += s;
+    if ( out_.size() >= 65536 )
+      Flush();
+  }
+
+  bool Flush() {
+    std::string::size_type done = 0;
+    while ( done < out_.size() ) {
+      ssize_t sent = ::send(fd_, out_.data() + done, out_.size() - done,
+                            MSG_NOSIGNAL);
+      if ( sent < 0 && errno == EINTR )
+        continue;
+      if ( sent <= 0 )
+        break;
+      done += sent;
+    } // while
+    bool ok = (done == out_.size());
+    out_.clear();
+    return(ok);
+  }
+
+private:
+  Connection(const Connection&); // not copyable
+  Connection& operator=(const Connection&);
+
+private:
+  int fd_;
+  std::string in_, out_;
+  std::string::size_type start_;
+};
+
+
+//==========================================================================
+// ConnectionQueue: connections passed between the dispatcher and workers
+//==========================================================================
+class ConnectionQueue {
+
+public:
+  ConnectionQueue() {
+    pthread_mutex_init(&mutex_, 0);
+    pthread_cond_init(&cond_, 0);
+  }
+
+  void Push(Connection* c) {
+    pthread_mutex_lock(&mutex_);
+    conns_.push_back(c);
+    pthread_cond_signal(&cond_);
+    pthread_mutex_unlock(&mutex_);
+  }
+
+  // Blocks until a connection is available
+  Connection* Pop() {
+    pthread_mutex_lock(&mutex_);
+    while ( conns_.empty() )
+      pthread_cond_wait(&cond_, &mutex_);
+    Connection* c = conns_.front();
+    conns_.pop_front();
+    pthread_mutex_unlock(&mutex_);
+    return(c);
+  }
+
+  // Takes everything queued without blocking
+  void PopAll(std::vector<Connection*>& v) {
+    pthread_mutex_lock(&mutex_);
+    v.insert(v.end(), conns_.begin(), conns_.end());
+    conns_.clear();
+    pthread_mutex_unlock(&mutex_);
+  }
+
+private:
+  pthread_mutex_t mutex_;
+  pthread_cond_t cond_;
+  std::deque<Connection*> conns_;
+};
+
+
+//==========================================================================
+// Answer(): run one request line and write its response
+//==========================================================================
+void Answer(const TrackMap& tracks, const std::string& line,
+            Connection& conn) {
+  std::istringstream is(line);
+  std::string name;
+  is >> name;
+
+  if ( name == "TRACKS" ) {
+    std::ostringstream os;
+    for ( TrackMap::const_iterator i = tracks.begin(); i != tracks.end(); ++i )
+      os << i->first << "\t" << i->second->size_ << "\n";
+    os << ".\n";
+    conn.Write(os.str());
+    return;
+  }
+
+  std::size_t first = 0, last = 0, minLength = 0;
+  double threshold = 0, minScore = 0;
+  bool scoreFilter = false;
+  is >> first >> last >> threshold;
+  if ( !is ) {
+    conn.Write("ERR expect: <track> <first> <last> <threshold> "
+               "[<min-length> [<min-score>]]\n");
+    return;
+  }
+  if ( is >> minLength )
+    scoreFilter = static_cast<bool>(is >> minScore);
+
+  TrackMap::const_iterator t = tracks.find(name);
+  if ( t == tracks.end() ) {
+    conn.Write("ERR unknown track: " + name + "\n");
+    return;
+  }
+  const Track& track = *t->second;
+  if ( last > track.size_ )
+    last = track.size_;
+  if ( first > last )
+    first = last;
+
+  // Results stream out as they are formatted; Connection flushes as needed
+  typedef std::pair<const double*, const double*> PairType;
+  std::vector<PairType> algOutput;
+  mss::AlgMSS(track.begin_ + first, track.begin_ + last,
+              std::back_inserter(algOutput), threshold);
+
+  char buf[128];
+  for ( std::size_t i = 0; i < algOutput.size(); ++i ) {
+    std::size_t len = algOutput[i].second - algOutput[i].first;
+    if ( len < minLength )
+      continue;
+    double score = 0;
+    for ( const double* j = algOutput[i].first; j != algOutput[i].second; )
+      score += *j++ - threshold;
+    if ( scoreFilter && score < minScore )
+      continue;
+    std::sprintf(buf, "%lu\t%lu\t%.10g\n",
+                 static_cast<unsigned long>(algOutput[i].first - track.begin_),
+                 static_cast<unsigned long>(algOutput[i].second - track.begin_),
+                 score);
+    conn.Write(buf);
+  } // for
+  conn.Write(".\n");
+}
+
+
+//==========================================================================
+// Worker(): answer every complete request on a readable connection, then
+//  give the connection back to the dispatcher to wait for more
+//==========================================================================
+struct WorkerArgs {
+  const TrackMap* tracks_;
+  ConnectionQueue* ready_;  // readable, waiting for a worker
+  ConnectionQueue* idle_;   // answered, back to the dispatcher
+  int wake_;                // write end of the dispatcher's pipe
+};
+
+extern "C" void* Worker(void* p) {
+  WorkerArgs* args = static_cast<WorkerArgs*>(p);
+  std::string line;
+  while ( true ) {
+    Connection* conn = args->ready_->Pop();
+    bool ok = conn->Receive();
+    while ( ok && conn->NextLine(line) ) {
+      Answer(*args->tracks_, line, *conn);
+      ok = conn->Flush();
+    } // while
+
+    if ( !ok ) {
+      delete conn;
+      continue;
+    }
+    args->idle_->Push(conn);
+    char c = 0;
+    while ( ::write(args->wake_, &c, 1) < 0 && errno == EINTR )
+      ;
+  } // while
+  return(0);
+}
+
+
+volatile std::sig_atomic_t stopServer = 0;
+
+extern "C" void Stop(int) { stopServer = 1; }
+
+
+//======
+// main
+//======
+int main(int argc, char** argv) {
+
+  // Simple error check
+  if ( argc < 4 ) {
+    std::cerr << "Expect: " << argv[0]
+              << " <socket-path> <threads> <name=file> [<name=file> ...]"
+              << std::endl;
+    return(-1);
+  }
+  std::string socketPath = argv[1];
+  int nthreads = std::atoi(argv[2]);
+  if ( nthreads < 1 )
+    nthreads = 1;
+
+
+  // Load every track once
+  TrackMap tracks;
+  try {
+    for ( int i = 3; i < argc; ++i ) {
+      std::string arg = argv[i];
+      std::string::size_type eq = arg.find('=');
+      if ( eq == std::string::npos || eq == 0 ) {
+        std::cerr << "Expect <name=file>, got: " << arg << std::endl;
+        return(-1);
+      }
+      tracks[arg.substr(0, eq)] = new Track(arg.substr(eq + 1));
+      std::cerr << "Loaded " << arg.substr(0, eq) << ": "
+                << tracks[arg.substr(0, eq)]->size_ << " scores" << std::endl;
+    } // for
+  } catch(std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return(-1);
+  }
+
+
+  // Listen on the Unix domain socket
+  sockaddr_un addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if ( socketPath.size() >= sizeof(addr.sun_path) ) {
+    std::cerr << "Socket path too long: " << socketPath << std::endl;
+    return(-1);
+  }
+  std::strcpy(addr.sun_path, socketPath.c_str());
+  ::unlink(socketPath.c_str());
+
+  int listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if ( listenFd < 0 ||
+       ::bind(listenFd, reinterpret_cast<sockaddr*>(&addr),
+              sizeof(addr)) != 0 ||
+       ::listen(listenFd, 128) != 0 ) {
+    std::perror(socketPath.c_str());
+    return(-1);
+  }
+
+
+  // Start the thread pool, then hand it connections until told to stop
+  struct sigaction sa;
+  std::memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = Stop;
+  ::sigaction(SIGINT, &sa, 0);
+  ::sigaction(SIGTERM, &sa, 0);
+
+  int wake[2];
+  if ( ::pipe(wake) != 0 ) {
+    std::perror("pipe");
+    return(-1);
+  }
+  ::fcntl(wake[0], F_SETFL, O_NONBLOCK);
+
+  ConnectionQueue ready, idle;
+  WorkerArgs args = { &tracks, &ready, &idle, wake[1] };
+  for ( int i = 0; i < nthreads; ++i ) {
+    pthread_t thread;
+    if ( pthread_create(&thread, 0, Worker, &args) != 0 ) {
+      std::cerr << "Unable to start worker threads" << std::endl;
+      return(-1);
+    }
+    pthread_detach(thread);
+  } // for
+  std::cerr << "Listening on " << socketPath << " with " << nthreads
+            << " threads" << std::endl;
+
+
+  // Dispatcher: wait for new connections and for requests on idle ones
+  std::vector<Connection*> waiting, returned;
+  std::vector<pollfd> fds;
+  while ( !stopServer ) {
+    fds.resize(2 + waiting.size());
+    fds[0].fd = listenFd;
+    fds[1].fd = wake[0];
+    for ( std::size_t i = 0; i < waiting.size(); ++i )
+      fds[2 + i].fd = waiting[i]->Fd();
+    for ( std::size_t i = 0; i < fds.size(); ++i ) {
+      fds[i].events = POLLIN;
+      fds[i].revents = 0;
+    } // for
+
+    if ( ::poll(&fds[0], fds.size(), -1) < 0 ) {
+      if ( errno != EINTR )
+        std::perror("poll");
+      continue;
+    }
+
+    // Readable (or hung up) connections go to the workers
+    std::size_t keep = 0;
+    for ( std::size_t i = 0; i < waiting.size(); ++i ) {
+      if ( fds[2 + i].revents )
+        ready.Push(waiting[i]);
+      else
+        waiting[keep++] = waiting[i];
+    } // for
+    waiting.resize(keep);
+
+    if ( fds[1].revents ) {
+      char buf[256];
+      while ( ::read(wake[0], buf, sizeof(buf)) > 0 )
+        ;
+      returned.clear();
+      idle.PopAll(returned);
+      waiting.insert(waiting.end(), returned.begin(), returned.end());
+    }
+
+    if ( fds[0].revents ) {
+      int fd = ::accept(listenFd, 0, 0);
+      if ( fd >= 0 )
+        waiting.push_back(new Connection(fd));
+      else if ( errno != EINTR )
+        std::perror("accept");
+    }
+  } // while
+
+  ::close(listenFd);
+  ::unlink(socketPath.c_str());
+  return(0);
+}
+
+
+/*
+  ------------
+  Discussion:
+  ------------
+  o Starting:
+     server.mss.example1 /tmp/mss.sock 8 chr1=chr1.bin chr2=chr2.txt
+    loads chr1.bin (raw doubles, memory mapped) and chr2.txt (numbers as
+    text, parsed once), starts 8 worker threads and listens on /tmp/mss.sock
+    until interrupted.
+
+  o Protocol:
+    Requests are single lines of text; any number may be sent on one
+     connection, each answered in turn:
+
+      <track> <first> <last> <threshold> [<min-length> [<min-score>]]
+
+     runs AlgMSS() on elements [first, last) of the named track.  Each
+     result is sent back as one line, "<start>\t<end>\t<score>", where
+     [start, end) are track positions and score is the sum of
+     (score - threshold) over them.  Results shorter than min-length, or
+     scoring below min-score, are left out.  A line holding a single "."
+     ends the response.
+
+      TRACKS
+
+     lists each "<track>\t<size>", followed by a "." line.
+
+     A malformed request or unknown track gets a single "ERR <message>" line.
+
+  o Threads:
+    The main thread only waits, with poll(), for new connections and for
+     requests on open ones.  A connection with a request waiting is handed
+     to the next free worker, which answers every complete request received
+     so far and hands the connection back.  So up to <threads> requests run
+     at once no matter how many clients are connected, and an idle client
+     never ties up a worker.  Track data are never written after loading,
+     so workers share them without locking.
+*/
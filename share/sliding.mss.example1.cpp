@@ -0,0 +1,161 @@
+/*
+
+FILE: sliding.mss.example1.cpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+#include "../include/MSS.hpp"
+#include "../include/MSSSliding.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+
+//=======================================================================
+// main(): Pass in 0 to 2 arguments: a window size (default 100000) and
+//         a step (default 1000).
+//
+// Streams integral scores into an mss::SlidingWindow<> and asks for the
+//  maximal scoring subsequences of the trailing window after every step
+//  scores.  Checks each answer against AlgMSS() run on that window alone,
+//  and times both.  A second SlidingWindow<> reports only what changed
+//  at each step, which is checked against the full answers.
+//=======================================================================
+int main(int argc, char** argv) {
+  using namespace std;
+  using namespace mss;
+
+  // Simple error check
+  if ( argc > 3 ) {
+    cerr << "Expect: " << argv[0] << " [<window> [<step>]]" << endl;
+    return(-1);
+  }
+  size_t window = (argc > 1) ? strtoul(argv[1], 0, 10) : 100000;
+  size_t step = (argc > 2) ? strtoul(argv[2], 0, 10) : 1000;
+  if ( window == 0 || step == 0 ) {
+    cerr << "window and step must be positive" << endl;
+    return(-1);
+  }
+
+  // Stream: noise around -1 with occasional bursts of activity
+  const size_t SZ = 2000000;
+  unsigned int rnd = (unsigned)time(NULL);
+  cerr << "Random seed: " << rnd << endl;
+  srand(rnd);
+  vector<double> stream(SZ);
+  for ( size_t i = 0; i < SZ; ++i ) {
+    stream[i] = rand() % 5 - 3;
+    if ( i % 50000 < 500 )
+      stream[i] += 3;
+  } // for
+
+  typedef vector<double>::const_iterator IterType;
+  typedef pair<IterType, IterType> PairType;
+  typedef SlidingWindow<double>::RangeType RangeType;
+  const double threshold = 0;
+
+  SlidingWindow<double> sliding(window, threshold), delta(window, threshold);
+  vector<RangeType> results, removed, added;
+  vector<PairType> algOutput;
+  double slidingTime = 0, deltaTime = 0, algTime = 0;
+  size_t mismatches = 0, steps = 0, segments = 0, changes = 0, live = 0;
+
+  for ( size_t i = 0; i < SZ; i += step, ++steps ) {
+    IterType beg = stream.begin() + i;
+    IterType end = (SZ - i > step) ? beg + step : stream.end();
+
+    results.clear();
+    clock_t start = clock();
+    sliding.Push(beg, end);
+    sliding.Segments(back_inserter(results));
+    slidingTime += double(clock() - start) / CLOCKS_PER_SEC;
+    segments += results.size();
+
+    removed.clear();
+    added.clear();
+    start = clock();
+    delta.Push(beg, end);
+    delta.Changes(back_inserter(removed), back_inserter(added));
+    deltaTime += double(clock() - start) / CLOCKS_PER_SEC;
+    changes += removed.size() + added.size();
+    live += added.size() - removed.size();
+    bool same = (live == results.size());
+    for ( size_t j = 0; same && j < added.size(); ++j )
+      same = binary_search(results.begin(), results.end(), added[j]);
+
+    algOutput.clear();
+    start = clock();
+    IterType first = stream.begin() + sliding.Start();
+    AlgMSS(first, end, back_inserter(algOutput), threshold);
+    algTime += double(clock() - start) / CLOCKS_PER_SEC;
+
+    same = same && (results.size() == algOutput.size());
+    for ( size_t j = 0; same && j < results.size(); ++j ) {
+      RangeType r(algOutput[j].first - stream.begin(),
+                  algOutput[j].second - stream.begin());
+      same = (results[j] == r);
+    } // for
+    mismatches += !same;
+  } // for
+
+
+  cout << "elements: " << SZ << "\twindow: " << window
+       << "\tstep: " << step << "\twindows: " << steps << endl;
+  cout << "mean subsequences per window: " << double(segments) / steps << endl;
+  cout << "mean changes per step: " << double(changes) / steps << endl;
+  cout << "sliding window seconds, all results: " << slidingTime << endl;
+  cout << "sliding window seconds, changes only: " << deltaTime << endl;
+  cout << "AlgMSS() per window seconds: " << algTime << endl;
+  cout << "windows differing from AlgMSS(): " << mismatches << endl;
+  return(mismatches == 0 ? 0 : -1);
+}
+
+
+/*
+  ------------
+  Discussion:
+  ------------
+  o Most of the Segments() time above is spent writing every result of
+     every window.  A monitor that only needs to know what appeared and what
+     went away should use Changes(), which pays little more than the cost of
+     the scores pushed since the last step.
+
+  o Between two steps, results can change only at the two ends of the
+     window: on the left, where scores expire and the segment straddling the
+     new start is split up, and on the right, where new scores arrive.
+     Everything between is untouched, and Changes() never looks at it.
+
+  o Scores are integral here so that the comparison with AlgMSS() is exact.
+     With floating point scores, a window holding two equally good
+     subsequences may occasionally see them split differently because of
+     rounding in the totals (see MSSSliding.hpp).
+*/
@@ -0,0 +1,157 @@
+/*
+
+FILE: spill.mss.example1.cpp
+AUTHOR: Shane Neph
+CREATE DATE: 2026
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+
+If the use of the MSS software results in outcomes which will be published,
+please specify the version of MSS software you used and cite the following
+reference:
+
+Ruzzo, W. L., and Tompa, M. 1999. A Linear Time Algorithm for Finding All
+Maximal Scoring Subsequences. Seventh International Conference on Intelligent
+Systems for Molecular Biology. 234-241.
+
+*/
+
+#include "../include/MSS.hpp"
+#include "../include/MSSSpill.hpp"
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <vector>
+
+
+//=======================================================================
+// Heap accounting: every operator new/delete goes through these, so the
+//  peak number of bytes held during the budgeted AlgMSS() can be checked.
+//=======================================================================
+namespace {
+  const std::size_t Header = 16; // keeps blocks suitably aligned
+  std::size_t heapNow = 0, heapPeak = 0;
+}
+
+void* operator new(std::size_t n) throw(std::bad_alloc) {
+  char* p = static_cast<char*>(std::malloc(n + Header));
+  if ( !p )
+    throw std::bad_alloc();
+  *reinterpret_cast<std::size_t*>(p) = n;
+  heapNow += n;
+  if ( heapNow > heapPeak )
+    heapPeak = heapNow;
+  return(p + Header);
+}
+
+void operator delete(void* v) throw() {
+  if ( !v )
+    return;
+  char* p = static_cast<char*>(v) - Header;
+  heapNow -= *reinterpret_cast<std::size_t*>(p);
+  std::free(p);
+}
+
+//=======================================================================
+// main(): Pass in 1 argument: a memory budget in bytes.
+//
+// Builds a worst case for AlgMSS()'s candidate list - each positive
+//  score is slightly smaller than the last, and each negative one cancels
+//  slightly less than the positive before it - so no candidate is
+//  resolved until the end.  Runs AlgMSS() with and without the budget and
+//  checks that the results agree, and that the budgeted run never held
+//  more than the budget on the heap.
+//=======================================================================
+int main(int argc, char** argv) {
+  using namespace std;
+  using namespace mss;
+
+  // Simple error check
+  if ( argc != 2 ) {
+    cerr << "Expect: " << argv[0] << " <memory-budget-bytes>" << endl;
+    return(-1);
+  }
+  size_t budget = strtoul(argv[1], 0, 10);
+
+  // Slowly increasing cumulative total
+  const size_t SZ = 2000000;
+  vector<double> myInput(SZ);
+  for ( size_t i = 0; i < SZ; i += 2 ) {
+    myInput[i] = 1000.0 - i * 1e-4;
+    if ( i + 1 < SZ )
+      myInput[i + 1] = -(myInput[i] - 5e-5);
+  } // for
+
+  typedef vector<double>::iterator IterType;
+  typedef pair<IterType, IterType> PairType;
+  vector<PairType> inMemory, budgeted;
+  budgeted.reserve(SZ); // so that only AlgMSS() allocates below
+
+  size_t peak = 0;
+  try {
+    const size_t before = heapPeak = heapNow;
+    AlgMSS(myInput.begin(), myInput.end(), back_inserter(budgeted), 0.0,
+           budget);
+    peak = heapPeak - before;
+  } catch(exception& e) {
+    cerr << e.what() << endl;
+    return(-1);
+  }
+
+  // Never below what a few hundred candidates need; see MSSSpill.hpp
+  detail::SpillStack<double> smallest(0);
+  const size_t limit = (budget > smallest.Memory()) ? budget
+                                                    : smallest.Memory();
+
+  AlgMSS(myInput.begin(), myInput.end(), back_inserter(inMemory), 0.0);
+
+  const bool ok = (budgeted == inMemory && peak <= limit);
+  cout << "subsequences: " << budgeted.size() << endl;
+  cout << "peak heap bytes with a budget: " << peak
+       << "\tbudget: " << budget << endl;
+  cout << "identical to AlgMSS() without a budget: "
+       << (budgeted == inMemory ? "yes" : "no") << endl;
+  cout << "within budget: " << (peak <= limit ? "yes" : "no") << endl;
+  return(ok ? 0 : -1);
+}
+
+
+/*
+  ------------
+  Discussion:
+  ------------
+  o Where memory goes:
+    AlgMSS() keeps every unresolved candidate in a std::list along with a
+     second std::list used to keep the search linear, so each one costs two
+     list nodes plus allocator overhead.  Usually the list stays short, but
+     inputs like the one above leave half of their elements unresolved.
+
+  o The budget:
+    The 5-argument AlgMSS() in MSSSpill.hpp keeps at most the given number
+     of bytes of candidates in memory (a few hundred candidates at minimum)
+     and moves the oldest to an anonymous temporary file.  Candidates are
+     small fixed-size records there, and are read back in blocks only when
+     the algorithm returns to them.  The peak reported above counts every
+     heap allocation made by the budgeted run; compare budgets of, say,
+     1000000 and 100000000, or run under a memory monitor.  The whole
+     budget is allocated when the search starts, so keep it realistic.
+
+  o Temporary files are created with std::tmpfile(), so they are removed
+     automatically and land wherever your C library puts them (often /tmp).
+*/
@@ -30,6 +30,7 @@ Systems for Molecular Biology. 234-241.
 */
 
 #include "../include/MSS.hpp"
+#include "../include/MSSQuantile.hpp"
 #include <algorithm>
 #include <cmath>
 #include <ctime>
@@ -57,20 +58,20 @@ int main() {
   const int MYMAX = 1234;
   InputType myInput;
 
-  // Populate it with random #'s
+  // Populate it with random #'s, estimating the median as they arrive
   unsigned int rnd = (unsigned)time(NULL);
   std::cerr << "Random seed: " << rnd << std::endl;
   srand(rnd);
-  for ( int i = 0; i < 50; ++i )
+  QuantileSketch<int> sketch;
+  for ( int i = 0; i < 50; ++i ) {
     myInput.push_back(rand() % MYMAX);
+    sketch.Add(myInput.back());
+  } // for
+  std::cerr << "Estimated median: " << sketch.Quantile(0.5) << std::endl;
 
-  // Find the median, shuffle input container's contents
-  InputType::iterator mid = myInput.begin();
-  advance(mid, static_cast<int>(myInput.size()/2));
-  nth_element(myInput.begin(), mid, myInput.end());
-  int myThreshold = *mid;
-  std::cerr << "Threshold: " << *mid << std::endl;
-  random_shuffle(myInput.begin(), myInput.end());
+  // Find the exact median without reordering the input container's contents
+  int myThreshold = ExactQuantile(myInput.begin(), myInput.end(), 0.5);
+  std::cerr << "Threshold: " << myThreshold << std::endl;
 
   // Create output types
   typedef pair<InputType::iterator, InputType::iterator> PairType;
@@ -119,4 +120,13 @@ int main() {
      function that accompanies the <algorithm> header file.  That (average)
      linear time algorithm is excellent, but does change the order of values.
      Perhaps pass a copy of your data to it?
+
+    A copy of a large track can be expensive, which is why this example uses
+     MSSQuantile.hpp instead:
+     - mss::QuantileSketch<> estimates any quantile while data are read in,
+        with bounded memory and a guaranteed bound on its rank error.
+        Sketches of separately read pieces may be merged.
+     - mss::ExactQuantile() finds the same value nth_element() would, using
+        two read-only passes over the data (a memory mapped file works well;
+        see quantile.mss.example1.cpp) and no copy of it.
 */